@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "BatchEvaluation.h"
+#include "Evaluation.h"
+#include "GameModel.h"
+
+// Evaluation Benchmarks
+// Compares one-at-a-time evaluation with the batched kernels
+namespace {
+    constexpr size_t BATCH_POSITIONS = 4096;
+
+    // Positions from reproducible playouts
+    const std::vector<GameModel>& samplePositions() {
+        static const std::vector<GameModel> positions = []() {
+            std::vector<GameModel> result;
+            uint32_t state = 2024;
+            while (result.size() < BATCH_POSITIONS) {
+                GameModel model;
+                model.initializeStandardGame("Player1", "Player2");
+                for (int ply = 0; ply < 80 && result.size() < BATCH_POSITIONS; ++ply) {
+                    MoveList moves;
+                    model.generateMoves(moves);
+                    if (moves.empty()) break;
+                    state = state * 1103515245u + 12345u;
+                    model.makeMove(moves[(state >> 16) % moves.size()]);
+                    result.push_back(model);
+                }
+            }
+            return result;
+        }();
+        return positions;
+    }
+
+    const PositionBatch& sampleBatch() {
+        static const PositionBatch batch = []() {
+            PositionBatch result;
+            for (const auto& model : samplePositions()) result.add(model);
+            return result;
+        }();
+        return batch;
+    }
+}
+
+static void BM_EvaluateOneByOne(benchmark::State& state) {
+    const auto& positions = samplePositions();
+    for (auto _ : state) {
+        for (const auto& model : positions) {
+            benchmark::DoNotOptimize(Evaluation::evaluate(model));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(positions.size()));
+}
+BENCHMARK(BM_EvaluateOneByOne);
+
+static void BM_EvaluateBatch(benchmark::State& state) {
+    auto kernel = static_cast<BatchEvaluation::Kernel>(state.range(0));
+    if (!BatchEvaluation::isSupported(kernel)) {
+        state.SkipWithError("kernel not supported on this CPU");
+        return;
+    }
+    state.SetLabel(BatchEvaluation::kernelName(kernel));
+
+    const PositionBatch& batch = sampleBatch();
+    std::vector<int32_t> scores(batch.size());
+    for (auto _ : state) {
+        BatchEvaluation::evaluate(batch, scores.data(), kernel);
+        benchmark::DoNotOptimize(scores.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK(BM_EvaluateBatch)
+    ->Arg(static_cast<int>(BatchEvaluation::Kernel::Scalar))
+    ->Arg(static_cast<int>(BatchEvaluation::Kernel::SSE2))
+    ->Arg(static_cast<int>(BatchEvaluation::Kernel::AVX2));
@@ -0,0 +1,204 @@
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "Board.h"
+#include "GameModel.h"
+#include "MoveList.h"
+
+// GameModel Benchmarks
+// Times the public GameModel API on a curated set of positions. Every
+// benchmark runs once per position; the position name is the label.
+namespace {
+    struct BenchPosition {
+        std::string name;
+        GameModel model;
+    };
+
+    uint32_t squares(std::initializer_list<Position> positions) {
+        uint32_t mask = 0;
+        for (const auto& pos : positions) mask |= 1u << squareIndex(pos);
+        return mask;
+    }
+
+    GameModel fromBitBoard(uint32_t player1, uint32_t player2, uint32_t dames, int side) {
+        BitBoard board;
+        board.pieces[0] = player1;
+        board.pieces[1] = player2;
+        board.dames = dames;
+        GameModel model;
+        model.initializeFromBitBoard("Player1", "Player2", board, side);
+        return model;
+    }
+
+    // Plays a fixed move sequence so the midgame is reproducible
+    GameModel playedOpening(int plies) {
+        GameModel model;
+        model.initializeStandardGame("Player1", "Player2");
+        for (int ply = 0; ply < plies; ++ply) {
+            MoveList moves;
+            model.generateMoves(moves);
+            if (moves.empty()) break;
+            model.executeMove(model.toMove(moves[(ply * 5 + 3) % moves.size()]));
+        }
+        return model;
+    }
+
+    std::vector<BenchPosition> buildPositions() {
+        std::vector<BenchPosition> positions;
+
+        GameModel opening;
+        opening.initializeStandardGame("Player1", "Player2");
+        positions.push_back({"opening", opening});
+        positions.push_back({"midgame", playedOpening(12)});
+
+        // Branching Pion chain: (1,1) can take two or three pieces
+        positions.push_back({"pion-chain", fromBitBoard(
+            squares({{1, 1}, {0, 4}, {1, 7}}),
+            squares({{2, 2}, {4, 4}, {4, 2}, {6, 6}, {6, 2}, {7, 7}}),
+            0, 0)});
+
+        // Dames on open diagonals with a capture chain for Player1
+        positions.push_back({"dame-endgame", fromBitBoard(
+            squares({{0, 0}, {2, 6}, {1, 3}}),
+            squares({{2, 2}, {4, 4}, {5, 3}, {6, 6}, {7, 1}}),
+            squares({{0, 0}, {2, 6}, {5, 3}, {6, 6}, {7, 1}}),
+            0)});
+
+        // Quiet Dame-only ending: long rays, no captures
+        positions.push_back({"dame-quiet", fromBitBoard(
+            squares({{0, 0}, {3, 1}, {0, 6}}),
+            squares({{7, 7}, {7, 1}, {6, 4}}),
+            squares({{0, 0}, {3, 1}, {0, 6}, {7, 7}, {7, 1}, {6, 4}}),
+            1)});
+        return positions;
+    }
+
+    const std::vector<BenchPosition>& positions() {
+        static const std::vector<BenchPosition> all = buildPositions();
+        return all;
+    }
+
+    const BenchPosition& positionFor(benchmark::State& state) {
+        const BenchPosition& position = positions()[static_cast<size_t>(state.range(0))];
+        state.SetLabel(position.name);
+        return position;
+    }
+
+    void allPositions(benchmark::internal::Benchmark* bench) {
+        bench->DenseRange(0, static_cast<int>(positions().size()) - 1);
+    }
+
+    // Discards everything written to it
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int ch) override { return ch; }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+}
+
+static void BM_GetAllValidMoves(benchmark::State& state) {
+    const GameModel& model = positionFor(state).model;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.getAllValidMoves());
+    }
+}
+BENCHMARK(BM_GetAllValidMoves)->Apply(allPositions);
+
+static void BM_GetValidMoves(benchmark::State& state) {
+    const GameModel& model = positionFor(state).model;
+
+    // Query every own piece, movable or not
+    std::vector<Position> pieces;
+    int side = model.getCurrentSide();
+    for (uint32_t mask = model.getBitBoard().pieces[side]; mask; ) {
+        pieces.push_back(squarePosition(popLowestSquare(mask)));
+    }
+
+    for (auto _ : state) {
+        for (const auto& pos : pieces) {
+            benchmark::DoNotOptimize(model.getValidMoves(pos));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(pieces.size()));
+}
+BENCHMARK(BM_GetValidMoves)->Apply(allPositions);
+
+static void BM_GenerateMoves(benchmark::State& state) {
+    const GameModel& model = positionFor(state).model;
+    MoveList moves;
+    for (auto _ : state) {
+        model.generateMoves(moves);
+        benchmark::DoNotOptimize(moves.size());
+    }
+}
+BENCHMARK(BM_GenerateMoves)->Apply(allPositions);
+
+static void BM_ExecuteMove(benchmark::State& state) {
+    const GameModel& prototype = positionFor(state).model;
+    Move move = prototype.getAllValidMoves().begin()->second.front();
+
+    // Fresh copies are made in batches so the untimed refill is amortised
+    constexpr size_t BATCH = 256;
+    std::vector<GameModel> copies;
+    size_t next = BATCH;
+    for (auto _ : state) {
+        if (next == BATCH) {
+            state.PauseTiming();
+            copies.assign(BATCH, prototype);
+            next = 0;
+            state.ResumeTiming();
+        }
+        copies[next++].executeMove(move);
+    }
+}
+BENCHMARK(BM_ExecuteMove)->Apply(allPositions);
+
+static void BM_MakeUnmakeMove(benchmark::State& state) {
+    GameModel model = positionFor(state).model;
+    MoveList moves;
+    model.generateMoves(moves);
+    for (auto _ : state) {
+        for (const auto& entry : moves) {
+            GameModel::UndoInfo undo = model.makeMove(entry);
+            model.unmakeMove(undo);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(moves.size()));
+}
+BENCHMARK(BM_MakeUnmakeMove)->Apply(allPositions);
+
+static void BM_Clone(benchmark::State& state) {
+    const GameModel& model = positionFor(state).model;
+    for (auto _ : state) {
+        GameModel* copy = model.clone();
+        benchmark::DoNotOptimize(copy);
+        delete copy;
+    }
+}
+BENCHMARK(BM_Clone)->Apply(allPositions);
+
+static void BM_IsGameOver(benchmark::State& state) {
+    const GameModel& model = positionFor(state).model;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(model.isGameOver());
+    }
+}
+BENCHMARK(BM_IsGameOver)->Apply(allPositions);
+
+static void BM_BoardDisplay(benchmark::State& state) {
+    GameModel model = positionFor(state).model;
+    Board board;
+    board.setModel(&model);
+
+    NullBuffer sink;
+    std::streambuf* original = std::cout.rdbuf(&sink);
+    for (auto _ : state) {
+        board.display();
+    }
+    std::cout.rdbuf(original);
+}
+BENCHMARK(BM_BoardDisplay)->Apply(allPositions);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <iterator>
+#include "GameModel.h"
+#include "MoveList.h"
+#include "Playout.h"
+
+// Playout Benchmarks
+// Random games from the standard start through the bitboard kernel, the
+// allocation-free GameModel API and the allocating public API
+namespace {
+    GameModel startPosition() {
+        GameModel model;
+        model.initializeStandardGame("Player1", "Player2");
+        return model;
+    }
+}
+
+static void BM_RandomPlayout(benchmark::State& state) {
+    GameModel start = startPosition();
+    Xoshiro256 rng(1);
+    int64_t plies = 0;
+    for (auto _ : state) {
+        PlayoutResult result = randomPlayout(start, rng);
+        plies += result.plies;
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["plies"] = benchmark::Counter(static_cast<double>(plies), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_RandomPlayout);
+
+static void BM_MakeMovePlayout(benchmark::State& state) {
+    GameModel start = startPosition();
+    Xoshiro256 rng(1);
+    MoveList moves;
+    for (auto _ : state) {
+        GameModel model = start;
+        for (int ply = 0; ply < DEFAULT_PLAYOUT_PLIES; ++ply) {
+            model.generateMoves(moves);
+            if (moves.empty()) break;
+            model.makeMove(moves[static_cast<int>(rng.below(static_cast<uint32_t>(moves.size())))]);
+        }
+        benchmark::DoNotOptimize(model.getHash());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MakeMovePlayout);
+
+static void BM_ExecuteMovePlayout(benchmark::State& state) {
+    GameModel start = startPosition();
+    Xoshiro256 rng(1);
+    for (auto _ : state) {
+        GameModel model = start;
+        for (int ply = 0; ply < DEFAULT_PLAYOUT_PLIES; ++ply) {
+            auto allMoves = model.getAllValidMoves();
+            if (allMoves.empty()) break;
+            auto group = allMoves.begin();
+            std::advance(group, rng.below(static_cast<uint32_t>(allMoves.size())));
+            model.executeMove(group->second[rng.below(static_cast<uint32_t>(group->second.size()))]);
+        }
+        benchmark::DoNotOptimize(model.getHash());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExecuteMovePlayout);
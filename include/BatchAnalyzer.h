@@ -0,0 +1,78 @@
+#ifndef BATCHANALYZER_H
+#define BATCHANALYZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "CompactMove.h"
+#include "GameModel.h"
+#include "SearchEngine.h"
+
+struct AnalysisConfig {
+    unsigned threads = 0;        // 0 uses one thread per hardware thread
+    size_t queueSize = 4096;     // Positions read but not yet handed to the sink
+    bool search = false;         // Also search each position that isn't over
+    SearchLimits limits;
+    size_t hashMB = 1;           // Table size of each worker's search engine
+};
+
+struct PositionAnalysis {
+    uint64_t index = 0;          // Line number in the input, from 0
+    bool valid = false;          // False when the line isn't a position notation
+    std::vector<CompactMove> moves;   // Legal moves in generator order
+    bool gameOver = false;
+    int winner = NO_SIDE;        // Set once the game is over
+
+    // Search result, when searched and the game isn't over
+    bool searched = false;
+    CompactMove bestMove;
+    int score = 0;               // From the side to move's point of view
+    int depth = 0;
+};
+
+// Analyzes a stream of positions, one notation per line (see
+// GameModel::toNotation), on a pool of workers. Each worker keeps its own
+// GameModel and, when searching, its own single-threaded SearchEngine,
+// reused for every position it takes.
+//
+// At most queueSize positions are in flight: the source isn't read again
+// until the oldest one has been handed to the sink, so memory stays
+// bounded however fast the input arrives. Results reach the sink in input
+// order, one at a time, from whichever worker completes the next one due.
+class BatchAnalyzer {
+public:
+    // Fills line with the next input line; false at the end of the input
+    using Source = std::function<bool(std::string& line)>;
+    using Sink = std::function<void(const PositionAnalysis&)>;
+
+    struct Summary {
+        uint64_t positions = 0;
+        uint64_t invalid = 0;
+        uint64_t gameOver = 0;
+    };
+
+    explicit BatchAnalyzer(const AnalysisConfig& config);
+
+    // Reads the source on the calling thread until it ends
+    Summary run(const Source& source, const Sink& sink);
+
+    // One position on the calling thread. Trailing whitespace in the line
+    // is ignored. Each search starts from an empty table, so results don't
+    // depend on which positions the engine saw before.
+    static void analyze(const std::string& line, GameModel& model, SearchEngine* engine,
+                        const SearchLimits& limits, PositionAnalysis& result);
+
+    // Text form of a result: index, then "invalid", or the result ("*"
+    // while the game goes on, "1-0" or "0-1" once it's over), the move
+    // count and the moves as "from-to" or "fromxto" square numbers, then
+    // "best MOVE score N depth N" when searched
+    static void write(std::ostream& out, const PositionAnalysis& result);
+
+private:
+    AnalysisConfig config;
+};
+
+#endif // BATCHANALYZER_H
@@ -0,0 +1,49 @@
+#ifndef BATCHEVALUATION_H
+#define BATCHEVALUATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BitBoard.h"
+#include "GameModel.h"
+
+// Positions stored structure-of-arrays, one array per bitboard word, so
+// vector kernels can load several positions per instruction.
+struct PositionBatch {
+    std::vector<uint32_t> player1;      // BitBoard::pieces[0]
+    std::vector<uint32_t> player2;      // BitBoard::pieces[1]
+    std::vector<uint32_t> dames;
+    std::vector<uint8_t> sideToMove;    // 0 or 1
+
+    size_t size() const { return player1.size(); }
+    bool empty() const { return player1.empty(); }
+    void clear();
+    void reserve(size_t count);
+
+    // A position needs a side to move: false, and nothing is added, for a
+    // side other than 0 or 1 (Evaluation::evaluate scores those 0)
+    bool add(const BitBoard& board, int side);
+    bool add(const GameModel& model);
+};
+
+// Static evaluation of many positions at once. Each score equals
+// Evaluation::evaluate() for the same position and side to move.
+//
+// Kernels process four (SSE2) or eight (AVX2) positions per step; the
+// best one the CPU supports is chosen at runtime, with a scalar fallback
+// for other processors and for the tail of the batch.
+class BatchEvaluation {
+public:
+    enum class Kernel { Scalar, SSE2, AVX2 };
+
+    // Writes batch.size() scores
+    static void evaluate(const PositionBatch& batch, int32_t* scores);
+    static void evaluate(const PositionBatch& batch, int32_t* scores, Kernel kernel);
+    static std::vector<int32_t> evaluate(const PositionBatch& batch);
+
+    static Kernel bestKernel();
+    static bool isSupported(Kernel kernel);
+    static const char* kernelName(Kernel kernel);
+};
+
+#endif // BATCHEVALUATION_H
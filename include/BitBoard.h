@@ -0,0 +1,116 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>
+#include "Position.h"
+
+// Packed board representation used by GameModel's move generators.
+//
+// Only the 32 dark squares ((x + y) even) are playable. They are numbered
+// 0..31 row by row, four per row, so square order matches Position order:
+//
+//   row 0: (0,0)=0  (0,2)=1  (0,4)=2  (0,6)=3
+//   row 1: (1,1)=4  (1,3)=5  (1,5)=6  (1,7)=7
+//   ...
+//   row 7: (7,1)=28 (7,3)=29 (7,5)=30 (7,7)=31
+//
+// Side 0 is player1 (starts on rows 0-1 and moves toward row 7), side 1 is
+// player2 (starts on rows 6-7 and moves toward row 0).
+
+constexpr int NUM_SQUARES = 32;
+constexpr int NUM_SIDES = 2;
+constexpr int NO_SIDE = -1;
+
+// Diagonal directions, in the order the generators explore them.
+enum Direction { DOWN_RIGHT = 0, DOWN_LEFT = 1, UP_RIGHT = 2, UP_LEFT = 3 };
+constexpr int NUM_DIRECTIONS = 4;
+
+namespace BitMasks {
+    constexpr uint32_t EVEN_ROWS = 0x0F0F0F0Fu;   // rows 0, 2, 4, 6
+    constexpr uint32_t ODD_ROWS = 0xF0F0F0F0u;    // rows 1, 3, 5, 7
+    constexpr uint32_t LEFT_EDGE = 0x01010101u;   // column 0
+    constexpr uint32_t RIGHT_EDGE = 0x80808080u;  // column 7
+    constexpr uint32_t ROW_0 = 0x0000000Fu;
+    constexpr uint32_t ROW_7 = 0xF0000000u;
+}
+
+struct BitBoard {
+    uint32_t pieces[NUM_SIDES] = {0, 0};  // All pieces of each side
+    uint32_t dames = 0;                   // Dames of either side
+
+    uint32_t occupied() const { return pieces[0] | pieces[1]; }
+    uint32_t empty() const { return ~occupied(); }
+    uint32_t pions(int side) const { return pieces[side] & ~dames; }
+    uint32_t damesOf(int side) const { return pieces[side] & dames; }
+
+    int sideAt(int square) const {
+        uint32_t bit = 1u << square;
+        if (pieces[0] & bit) return 0;
+        if (pieces[1] & bit) return 1;
+        return NO_SIDE;
+    }
+
+    bool operator==(const BitBoard& other) const {
+        return pieces[0] == other.pieces[0] && pieces[1] == other.pieces[1] && dames == other.dames;
+    }
+    bool operator!=(const BitBoard& other) const { return !(*this == other); }
+};
+
+inline bool isPlayableSquare(const Position& pos) {
+    return pos.x >= 0 && pos.x < 8 && pos.y >= 0 && pos.y < 8 && ((pos.x + pos.y) & 1) == 0;
+}
+
+inline int squareIndex(const Position& pos) {
+    return pos.x * 4 + pos.y / 2;
+}
+
+inline Position squarePosition(int square) {
+    int row = square >> 2;
+    return Position(row, ((square & 3) << 1) | (row & 1));
+}
+
+inline int popCount(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    for (; mask; mask &= mask - 1) ++count;
+    return count;
+#endif
+}
+
+// Index of the lowest set bit; mask must be non-zero.
+inline int lowestSquare(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int square = 0;
+    while (!(mask & 1u)) { mask >>= 1; ++square; }
+    return square;
+#endif
+}
+
+inline int popLowestSquare(uint32_t& mask) {
+    int square = lowestSquare(mask);
+    mask &= mask - 1;
+    return square;
+}
+
+// Moves every bit in the mask one square along the given diagonal.
+// Bits that would leave the board are dropped.
+inline uint32_t shiftSquares(uint32_t mask, int direction) {
+    using namespace BitMasks;
+    switch (direction) {
+        case DOWN_RIGHT: return ((mask & EVEN_ROWS) << 4) | ((mask & ODD_ROWS & ~RIGHT_EDGE) << 5);
+        case DOWN_LEFT:  return ((mask & EVEN_ROWS & ~LEFT_EDGE) << 3) | ((mask & ODD_ROWS) << 4);
+        case UP_RIGHT:   return ((mask & EVEN_ROWS) >> 4) | ((mask & ODD_ROWS & ~RIGHT_EDGE) >> 3);
+        case UP_LEFT:    return ((mask & EVEN_ROWS & ~LEFT_EDGE) >> 5) | ((mask & ODD_ROWS) >> 4);
+    }
+    return 0;
+}
+
+inline uint32_t promotionRow(int side) {
+    return side == 0 ? BitMasks::ROW_7 : BitMasks::ROW_0;
+}
+
+#endif // BITBOARD_H
@@ -0,0 +1,108 @@
+#ifndef COMPACTMOVE_H
+#define COMPACTMOVE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include "BitBoard.h"
+
+// Only the 18 interior dark squares (rows 1-6, columns 1-6) can hold a
+// captured piece, so a capture set fits in an 18-bit mask.
+constexpr int NUM_INTERIOR_SQUARES = 18;
+
+struct InteriorSquares {
+    int8_t interiorIndex[NUM_SQUARES] = {};         // -1 for edge squares
+    int8_t square[NUM_INTERIOR_SQUARES] = {};
+};
+
+constexpr InteriorSquares buildInteriorSquares() {
+    InteriorSquares table{};
+    int next = 0;
+    for (int sq = 0; sq < NUM_SQUARES; ++sq) {
+        int row = sq >> 2;
+        int col = ((sq & 3) << 1) | (row & 1);
+        if (row >= 1 && row <= 6 && col >= 1 && col <= 6) {
+            table.interiorIndex[sq] = static_cast<int8_t>(next);
+            table.square[next++] = static_cast<int8_t>(sq);
+        } else {
+            table.interiorIndex[sq] = -1;
+        }
+    }
+    return table;
+}
+
+inline constexpr InteriorSquares INTERIOR_SQUARES = buildInteriorSquares();
+
+// Packed move for search and storage, trivially copyable and hashable.
+//
+// Layout (32 bits):
+//   bits  0-4   from square (bitboard index)
+//   bits  5-9   destination square
+//   bit   10    Pion promotes on this move
+//   bits 11-28  captured pieces, one bit per interior square
+//
+// The intermediate landing squares of a capture are not stored: they are
+// recovered from the position by GameModel::decodeMove. A legal move never
+// ends on its own starting square, so the all-zero value is the null move.
+class CompactMove {
+public:
+    constexpr CompactMove() : bits(0) {}
+
+    static CompactMove make(int from, int to, uint32_t capturedMask, bool promotion) {
+        uint32_t captures = 0;
+        for (uint32_t mask = capturedMask; mask; ) {
+            int index = INTERIOR_SQUARES.interiorIndex[popLowestSquare(mask)];
+            if (index >= 0) captures |= 1u << index;
+        }
+        return CompactMove(static_cast<uint32_t>(from) | (static_cast<uint32_t>(to) << TO_SHIFT) |
+                           (promotion ? PROMOTION_BIT : 0u) | (captures << CAPTURE_SHIFT));
+    }
+
+    static constexpr CompactMove fromRaw(uint32_t raw) { return CompactMove(raw); }
+    constexpr uint32_t raw() const { return bits; }
+
+    constexpr int from() const { return static_cast<int>(bits & SQUARE_MASK); }
+    constexpr int to() const { return static_cast<int>((bits >> TO_SHIFT) & SQUARE_MASK); }
+    constexpr bool isPromotion() const { return (bits & PROMOTION_BIT) != 0; }
+    constexpr bool isCapture() const { return (bits >> CAPTURE_SHIFT) != 0; }
+    constexpr bool isNull() const { return bits == 0; }
+    int captureCount() const { return popCount(bits >> CAPTURE_SHIFT); }
+
+    // Captured pieces as a bitboard square mask
+    uint32_t capturedMask() const {
+        uint32_t mask = 0;
+        for (uint32_t captures = bits >> CAPTURE_SHIFT; captures; ) {
+            mask |= 1u << INTERIOR_SQUARES.square[popLowestSquare(captures)];
+        }
+        return mask;
+    }
+
+    constexpr bool operator==(const CompactMove& other) const { return bits == other.bits; }
+    constexpr bool operator!=(const CompactMove& other) const { return bits != other.bits; }
+    constexpr bool operator<(const CompactMove& other) const { return bits < other.bits; }
+
+private:
+    static constexpr uint32_t SQUARE_MASK = 0x1Fu;
+    static constexpr int TO_SHIFT = 5;
+    static constexpr uint32_t PROMOTION_BIT = 1u << 10;
+    static constexpr int CAPTURE_SHIFT = 11;
+
+    explicit constexpr CompactMove(uint32_t raw) : bits(raw) {}
+
+    uint32_t bits;
+};
+
+static_assert(sizeof(CompactMove) == 4, "CompactMove must stay 32 bits");
+static_assert(std::is_trivially_copyable<CompactMove>::value, "CompactMove must be trivially copyable");
+
+namespace std {
+    template <>
+    struct hash<CompactMove> {
+        size_t operator()(const CompactMove& move) const noexcept {
+            return std::hash<uint32_t>()(move.raw());
+        }
+    };
+}
+
+#endif // COMPACTMOVE_H
@@ -0,0 +1,25 @@
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+#include "BitBoard.h"
+#include "GameModel.h"
+#include "PieceSquareTables.h"
+
+// Static evaluation in centi-pions from the side to move's point of view.
+//
+// Material, advancement, back-rank guards and centre control come from
+// the piece-square sums GameModel updates incrementally; mobility, which
+// depends on the whole board, is counted from the bitboard with a few
+// shifts per side.
+class Evaluation {
+public:
+    static constexpr int MOBILITY_WEIGHT = 2;   // Per available step
+
+    static int evaluate(const GameModel& model);
+
+    // Steps available to a side's pieces: forward steps of Pions plus the
+    // first square of each Dame ray
+    static int mobility(const BitBoard& board, int side);
+};
+
+#endif // EVALUATION_H
@@ -6,59 +6,179 @@
 #include <map>
 #include "Piece.h"
 #include "Move.h"
+#include "BitBoard.h"
+#include "MoveList.h"
+#include "CompactMove.h"
 
-class GameModel {
+class GameModel;
+
+// Piece* grid over a snapshot of a position, indexed [x][y], nullptr on
+// empty squares. The view owns its pieces, so its pointers stay valid for
+// as long as the view does, whatever happens to the model afterwards.
+class BoardView {
+public:
+    BoardView() = default;
+    BoardView(const BoardView& other);
+    BoardView(BoardView&& other) = default;
+    BoardView& operator=(const BoardView& other);
+    BoardView& operator=(BoardView&& other) = default;
+    
+    const std::vector<Piece*>& operator[](size_t x) const { return grid[x]; }
+    size_t size() const { return grid.size(); }
+    
 private:
+    friend class GameModel;
+    
+    // Points the grid at the pieces; they never move once added
+    void link();
+    
     std::vector<std::vector<Piece*>> grid;
-    std::string currentPlayer;
+    std::vector<Piece> pieces;
+};
+
+// Receives every move played with GameModel::executeMove, after it has been
+// played. makeMove doesn't notify, so search never reaches an observer.
+class MoveObserver {
+public:
+    virtual ~MoveObserver() = default;
+    virtual void onMove(const GameModel& model, CompactMove move) = 0;
+};
+
+class GameModel {
+public:
+    // Everything needed to take back a move played with makeMove()
+    struct UndoInfo {
+        uint8_t from;
+        uint8_t to;
+        int8_t side;              // Side that moved, or NO_SIDE if nothing moved
+        int8_t previousSide;      // Side to move before the move
+        bool promoted;
+        uint32_t captured;        // Opponent pieces removed by the move
+        uint32_t capturedDames;   // Subset of captured that were Dames
+        uint64_t previousHash;
+        int previousPieceSquare[NUM_SIDES];
+    };
+
+private:
+    BitBoard bitboard;
+    uint64_t hash;              // Zobrist key, updated incrementally
+    int pieceSquare[NUM_SIDES]; // Material plus piece-square values, updated incrementally
+    int currentSide;            // Side to move, or NO_SIDE
+    std::string currentPlayer;  // Name of the side to move when it is NO_SIDE
     std::vector<Move> moveHistory;
     std::string player1Name;
     std::string player2Name;
+    MoveObserver* moveObserver;
     
     // Helper methods
-    void clearGrid();
     bool isValidPosition(const Position& pos) const;
     bool canAnyPieceCapture() const;
     bool isPlayer1(const std::string& player) const;
     bool isPlayer2(const std::string& player) const;
     std::string getOpponent(const std::string& player) const;
+    int sideOf(const std::string& player) const;
+    const std::string& playerName(int side) const;
     
-    // Move generation helpers
-    std::vector<Move> generatePionSimpleMoves(const Position& from) const;
-    std::vector<Move> generatePionCaptureMoves(const Position& from) const;
-    std::vector<Move> generateDameSimpleMoves(const Position& from) const;
-    std::vector<Move> generateDameCaptureMoves(const Position& from) const;
-    void generatePionCaptureSequences(const Position& from, const Position& current,
-                                  std::vector<Position>& path, std::vector<Position>& captured,
-                                  std::vector<Move>& allMoves) const;
-    void generateDameCaptureSequences(const Position& from, const Position& current,
-                                  std::vector<Position>& path, std::vector<Position>& captured,
-                                  std::vector<Move>& allMoves, int dx, int dy) const;
-    void checkPromotion(const Position& pos);
+    // Move generation helpers (operate on square indices of the bitboard)
+    void generatePionSimpleMoves(int from, MoveList& moves) const;
+    void generatePionCaptureMoves(int from, MoveList& moves) const;
+    void generateDameSimpleMoves(int from, MoveList& moves) const;
+    void generateDameCaptureMoves(int from, MoveList& moves) const;
+    void generatePionCaptureSequences(int side, int current, MoveList::Entry& sequence,
+                                  MoveList& moves) const;
+    void generateDameCaptureSequences(int side, int current, MoveList::Entry& sequence,
+                                  MoveList& moves) const;
+    void checkPromotion(int square);
+    void updatePieceSquareScores();
+    bool promotesOn(int from, int to) const;
+    UndoInfo applyMove(int from, int to, uint32_t capturedMask);
     
     // Rule validation helpers
     bool isValidPionMove(const Position& from, const Position& to, const Piece* piece) const;
 
 public:
     GameModel();
+    // Copies everything but the move observer, which stays with the original
+    GameModel(const GameModel& other);
+    GameModel& operator=(const GameModel& other);
     ~GameModel();
     
     // Core game functionality
     void initializeStandardGame(const std::string& player1, const std::string& player2);
     void initializeFromGrid(const std::vector<std::vector<Piece*>>& initialGrid);
+    void initializeFromBitBoard(const std::string& player1, const std::string& player2,
+                                const BitBoard& board, int sideToMove);
     void executeMove(const Move& move);
     
+    // One-line position notation: the side to move ('1' or '2'), ':', then
+    // one character per dark square in square order (see BitBoard.h): '.'
+    // empty, 'x'/'X' Player1 Pion/Dame, 'o'/'O' Player2 Pion/Dame. The
+    // standard start is "1:xxxxxxxx................oooooooo".
+    static constexpr size_t NOTATION_LENGTH = 2 + NUM_SQUARES;
+    std::string toNotation() const;
+    // Writes exactly NOTATION_LENGTH characters, no terminator
+    void writeNotation(char* out) const;
+    // Sets up the position and clears the move history, keeping the player
+    // names ("Player1" and "Player2" when none are set yet). Returns false
+    // and leaves the model unchanged when the text isn't a valid notation.
+    // Allocates nothing, so one model can load any number of positions.
+    bool fromNotation(const std::string& notation);
+    bool fromNotation(const char* text, size_t length);
+    
+    // At most one observer; nullptr detaches it. Copies of the model and
+    // clone() don't keep the observer, so moves played on them aren't seen.
+    void setMoveObserver(MoveObserver* observer) { moveObserver = observer; }
+    MoveObserver* getMoveObserver() const { return moveObserver; }
+    
+    // In-place move application for tree search. Unlike executeMove these
+    // don't touch the move history; unmakeMove must be called in reverse
+    // order with the records returned by makeMove.
+    UndoInfo makeMove(const Move& move);
+    UndoInfo makeMove(const MoveList::Entry& entry);
+    UndoInfo makeMove(CompactMove move);
+    void unmakeMove(const UndoInfo& undo);
+    
     // Game state access
-    std::vector<std::vector<Piece*>> getBoard() const { return grid; }
-    std::string getCurrentPlayer() const { return currentPlayer; }
+    BoardView getBoard() const;
+    const BitBoard& getBitBoard() const { return bitboard; }
+    uint64_t getHash() const { return hash; }
+    int getPieceSquareScore(int side) const { return pieceSquare[side]; }
+    std::string getCurrentPlayer() const { return currentSide == NO_SIDE ? currentPlayer : playerName(currentSide); }
+    int getCurrentSide() const { return currentSide; }
     std::vector<Move> getMoveHistory() const { return moveHistory; }
     
     // Move queries
     std::vector<Move> getValidMoves(const Position& piecePos) const;
     std::map<Position, std::vector<Move>> getAllValidMoves() const;
     
-    // Game status
+    // Allocation-free move generation: fills the list with every legal move
+    // of the current player, in square order (captures only when available)
+    void generateMoves(MoveList& moves) const;
+    Move toMove(const MoveList::Entry& entry) const;
+    
+    // Capture-only generation for tactical search: fills the list with the
+    // capture moves when the player must capture and leaves it empty
+    // otherwise, without generating any quiet move
+    void generateCaptures(MoveList& moves) const;
+    
+    // Whether the current player has a non-capturing move, without
+    // generating it
+    bool hasQuietMove() const;
+    
+    // Compact move encoding. Encoding reads the piece type from the current
+    // position and decoding rebuilds the capture path from it, so both must
+    // be done in the position the move is played from. Decoding an illegal
+    // move returns a Move with an empty path.
+    CompactMove encodeMove(const Move& move) const;
+    CompactMove encodeMove(const MoveList::Entry& entry) const;
+    Move decodeMove(CompactMove move) const;
+    
+    // Game status. The game is over when the current player has no legal
+    // move; these stop at the first move found without generating any.
+    bool hasAnyLegalMove() const;
     bool isGameOver() const;
+    // Side that has won, NO_SIDE while the game goes on
+    int getWinnerSide() const;
     std::string getWinner() const;
     int getPieceCount(const std::string& player) const;
     
@@ -0,0 +1,141 @@
+#ifndef GAMERECORDFILE_H
+#define GAMERECORDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BitBoard.h"
+#include "CompactMove.h"
+#include "GameModel.h"
+
+// Append-only binary file of recorded games.
+//
+// The file starts with an 8-byte header: "TCGR", then a little-endian
+// 16-bit version and 16 reserved bits. Games follow back to back, each a
+// start marker, its moves and an end marker:
+//
+//   0xC0                 game from the standard start position
+//   0xC1 / 0xC2          game from a custom position, Player1 / Player2 to
+//                        move, followed by pieces[0], pieces[1] and dames
+//                        as little-endian 32-bit masks
+//   from, to             a move: from square in bits 0-4, bit 5 set when a
+//                        capture mask follows; to square in bits 0-4, bit 5
+//                        set when a Pion promotes
+//   3 bytes              capture mask over the 18 interior squares, as in
+//                        CompactMove, little-endian
+//   0x80 / 0x81 / 0x82   end of game: draw or unfinished / Player1 won /
+//                        Player2 won
+//
+// A quiet move takes 2 bytes and a capture 5, whatever its length: the
+// landing squares are recovered with GameModel::decodeMove on replay.
+// Start and end markers have the top bit set, which no move byte has.
+struct RecordedGame {
+    bool standardStart = true;
+    BitBoard start;                  // Only meaningful for a custom start
+    int sideToMove = 0;
+    std::vector<CompactMove> moves;
+    int winner = NO_SIDE;            // NO_SIDE for a draw or an unfinished game
+
+    // Sets the model to the start position of the game
+    void setUp(GameModel& model) const;
+};
+
+// Streams games into a record file. Games can be written move by move, or
+// the writer can be attached to a live GameModel and record every
+// executeMove.
+class GameRecordWriter : public MoveObserver {
+public:
+    static constexpr char MAGIC[4] = {'T', 'C', 'G', 'R'};
+    static constexpr uint16_t VERSION = 1;
+
+    GameRecordWriter() = default;
+    ~GameRecordWriter() override;
+
+    GameRecordWriter(const GameRecordWriter&) = delete;
+    GameRecordWriter& operator=(const GameRecordWriter&) = delete;
+
+    // Opens for appending and writes the header into an empty file. False
+    // if the file can't be opened or an existing file isn't a record file
+    // of this VERSION.
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file.is_open(); }
+
+    // A game in progress is ended as unfinished by the next beginGame or close
+    void beginGame(const GameModel& model);
+    void addMove(CompactMove move);
+    void endGame(int winner);
+    void writeGame(const RecordedGame& game);
+
+    // beginGame with the model's position, then records its executeMove
+    // calls until detach, which ends the game with the given winner
+    void attach(GameModel& model);
+    void detach(GameModel& model, int winner);
+    void onMove(const GameModel& model, CompactMove move) override;
+
+    // Hands buffered bytes to the file
+    void flush();
+
+    uint64_t gameCount() const { return games; }
+    uint64_t moveCount() const { return moves; }
+
+private:
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+    void put(uint8_t byte) {
+        buffer.push_back(byte);
+        if (buffer.size() >= BUFFER_SIZE) flush();
+    }
+    void putMask(uint32_t mask);
+
+    std::ofstream file;
+    std::vector<uint8_t> buffer;
+    bool inGame = false;
+    uint64_t games = 0;
+    uint64_t moves = 0;
+};
+
+// Reads a record file one game at a time through a fixed-size buffer, so
+// files of any size stream in constant memory.
+class GameRecordReader {
+public:
+    // False if the file can't be read or doesn't start with the header
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file.is_open(); }
+
+    // Next complete game; false at the end of the file or on malformed
+    // data, which failed() tells apart. A game cut off by the end of the
+    // file (a writer still running) counts as the end; one cut off by the
+    // next game's start marker (a writer that stopped mid-game) is
+    // returned as unfinished.
+    bool next(RecordedGame& game);
+    bool failed() const { return corrupt; }
+
+    // Next game played into the model with executeMove, so the model's
+    // history (and observer) see every move. False at the end, on
+    // malformed data or on a move that isn't legal in the replayed position.
+    bool replay(GameModel& model, int& winner);
+
+private:
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+    bool get(uint8_t& byte) {
+        if (position == filled && !refill()) return false;
+        byte = buffer[position++];
+        return true;
+    }
+    bool refill();
+    bool getMask(uint32_t& mask);
+
+    std::ifstream file;
+    std::vector<uint8_t> buffer;
+    size_t position = 0;
+    size_t filled = 0;
+    int pendingMarker = -1;          // Start marker read ahead by next()
+    bool corrupt = false;
+};
+
+#endif // GAMERECORDFILE_H
@@ -0,0 +1,140 @@
+#ifndef MCTSENGINE_H
+#define MCTSENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "CompactMove.h"
+#include "GameModel.h"
+#include "Move.h"
+#include "Playout.h"
+#include "ThreadPool.h"
+
+// Budget for one search; zero means unlimited, but at least one limit
+// must be set for search() to return on its own
+struct MCTSLimits {
+    uint64_t maxSimulations = 10000;  // Summed over all threads
+    int64_t maxTimeMs = 0;
+    size_t maxNodes = 0;              // Tree size cap below the memory budget
+};
+
+struct MCTSResult {
+    Move bestMove;                    // Empty path when the side to move has no move
+    uint32_t visits = 0;              // Simulations through bestMove
+    double winRate = 0.0;             // bestMove's score for the side to move, 0..1 (draws count half)
+    uint64_t simulations = 0;         // Run by this search
+    uint32_t reusedVisits = 0;        // Root visits kept from the previous search
+    size_t nodes = 0;                 // Tree size after the search
+    double seconds = 0.0;
+
+    bool hasMove() const { return !bestMove.path.empty(); }
+};
+
+// Monte Carlo tree search over GameModel with UCT selection and random
+// playouts.
+//
+// Nodes live in a fixed pool sized by the memory budget and are handed out
+// by an atomic bump allocator, a node's children in one contiguous block.
+// When the pool is full the tree stops growing and simulations continue
+// from its leaves. The pool is double buffered: when a new search starts
+// from a position one or two plies below the previous root, that subtree
+// is compacted into the spare buffer and its statistics are kept.
+//
+// With more than one thread, helpers run simulations on the same tree. A
+// thread descending through a node adds VIRTUAL_LOSS pending visits to it,
+// which read as losses until its result is backed up, so concurrent
+// threads spread over different lines. Each thread plays out on its own
+// copy of the position with its own random generator; a one-thread search
+// with the same seed is fully deterministic. Playouts run on randomPlayout's
+// bitboard kernel.
+class MCTSEngine {
+public:
+    static constexpr double EXPLORATION = 1.4;
+    static constexpr uint32_t VIRTUAL_LOSS = 3;
+    static constexpr int MAX_PLAYOUT_PLIES = 300;   // Longer playouts are draws
+
+    // threads 0 uses one thread per hardware thread
+    explicit MCTSEngine(size_t memoryMB = 64, unsigned threads = 1, uint64_t seed = 1);
+    ~MCTSEngine();
+
+    // Searches copies of the model; the model itself is not touched
+    MCTSResult search(const GameModel& model, const MCTSLimits& limits);
+
+    // Ends a running search from another thread
+    void stop() { stopSignal.store(true, std::memory_order_relaxed); }
+
+    // Not safe during a search
+    void setThreads(unsigned threads);
+    unsigned threadCount() const { return static_cast<unsigned>(workers.size()); }
+
+    // Drops the tree so the next search starts fresh
+    void clear();
+
+    size_t capacity() const { return poolCapacity; }
+    size_t treeSize() const;
+
+private:
+    enum NodeState : uint8_t { UNEXPANDED = 0, EXPANDING = 1, EXPANDED = 2 };
+
+    // 24 bytes. score counts half-points for the side that played move:
+    // 2 per win, 1 per draw. firstChild and childCount are published by
+    // the release store of state = EXPANDED.
+    struct Node {
+        uint32_t firstChild;
+        uint16_t childCount;
+        std::atomic<uint8_t> state;
+        CompactMove move;
+        std::atomic<uint32_t> visits;
+        std::atomic<uint32_t> score;
+        std::atomic<uint32_t> virtualLoss;
+    };
+
+    struct NodePool {
+        std::unique_ptr<Node[]> nodes;
+        std::atomic<size_t> used{0};
+    };
+
+    struct Worker {
+        int id = 0;
+        GameModel position;
+        Xoshiro256 rng;
+        uint64_t simulations = 0;
+        std::vector<uint32_t> path;
+        std::vector<int8_t> movers;    // Side that played the move into each path node
+    };
+
+    void run(Worker& worker);
+    void simulate(Worker& worker);
+    uint32_t select(const Node& parent) const;
+    bool expand(Node& node, const GameModel& position);
+    int playout(Worker& worker);
+    bool shouldStop(const Worker& worker);
+
+    bool reuseTree(const GameModel& model);
+    void compact(uint32_t newRoot);
+    void resetTree(const GameModel& model);
+    uint32_t allocate(size_t count);
+
+    Node& node(uint32_t index) const { return pools[active].nodes[index]; }
+
+    NodePool pools[2];
+    int active = 0;
+    size_t poolCapacity = 0;
+    size_t nodeLimit = 0;
+    bool hasTree = false;
+    GameModel rootPosition;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::unique_ptr<ThreadPool> threadPool;   // Runs the helper threads
+    uint64_t seed;
+
+    MCTSLimits limits;
+    std::chrono::steady_clock::time_point startTime;
+    std::atomic<bool> stopSignal{false};
+    std::atomic<uint64_t> sharedSimulations{0};
+};
+
+#endif // MCTSENGINE_H
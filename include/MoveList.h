@@ -0,0 +1,64 @@
+#ifndef MOVELIST_H
+#define MOVELIST_H
+
+#include <cstdint>
+#include "BitBoard.h"
+
+// A jumped piece needs a square on both sides of it along the diagonal, so
+// only the 18 interior dark squares can ever be captured. Each piece is
+// captured at most once, which bounds the length of any capture path.
+constexpr int MAX_CAPTURES = 18;
+
+// Upper bound on the moves of one position. Simple moves can't exceed
+// 4 * 31; capture sequences beyond the bound are dropped.
+constexpr int MAX_MOVES = 256;
+
+// Fixed-capacity, stack-friendly list of generated moves. Squares are
+// bitboard square indices (see BitBoard.h); nothing here allocates.
+class MoveList {
+public:
+    struct Entry {
+        uint8_t from;
+        uint8_t length;                  // Number of landing squares in path
+        uint8_t captures;                // Number of captured pieces (0 or length)
+        uint8_t path[MAX_CAPTURES];      // Landing squares in order
+        uint8_t captured[MAX_CAPTURES];  // Captured squares in jump order
+        uint32_t capturedMask;
+
+        int to() const { return path[length - 1]; }
+        bool isCapture() const { return captures != 0; }
+        int captureCount() const { return captures; }
+    };
+
+    MoveList() : count(0) {}
+
+    void clear() { count = 0; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count == MAX_MOVES; }
+
+    const Entry& operator[](int index) const { return moves[index]; }
+    Entry& operator[](int index) { return moves[index]; }
+    const Entry* begin() const { return moves; }
+    const Entry* end() const { return moves + count; }
+
+    void addSimple(int from, int to) {
+        if (full()) return;
+        Entry& entry = moves[count++];
+        entry.from = static_cast<uint8_t>(from);
+        entry.length = 1;
+        entry.captures = 0;
+        entry.path[0] = static_cast<uint8_t>(to);
+        entry.capturedMask = 0;
+    }
+
+    void add(const Entry& entry) {
+        if (!full()) moves[count++] = entry;
+    }
+
+private:
+    Entry moves[MAX_MOVES];
+    int count;
+};
+
+#endif // MOVELIST_H
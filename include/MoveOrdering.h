@@ -0,0 +1,57 @@
+#ifndef MOVEORDERING_H
+#define MOVEORDERING_H
+
+#include <cstdint>
+#include "BitBoard.h"
+#include "CompactMove.h"
+#include "MoveList.h"
+
+// Ranks generated moves for alpha-beta search so likely cutoffs are tried
+// first. Captures are mandatory, so a move list is either all captures or
+// all quiet moves. After the transposition-table move, captures rank by
+// the number of pieces taken (Dames breaking ties) and quiet moves by
+// promotion, then the two killer moves of the ply, then a butterfly
+// history table indexed by side, from and to square.
+//
+// Holds per-thread state; each search thread owns one.
+class MoveOrdering {
+public:
+    static constexpr int MAX_PLY = 128;
+
+    static constexpr int TT_MOVE_SCORE = 1 << 30;
+    static constexpr int CAPTURE_SCORE = 1 << 28;
+    static constexpr int PROMOTION_SCORE = 1 << 27;
+    static constexpr int KILLER_SCORE = 1 << 26;
+    static constexpr int MAX_HISTORY = 1 << 16;
+
+    MoveOrdering() { clear(); }
+
+    void clear();
+
+    // Fills scores[i] for every move; larger is searched earlier
+    void scoreMoves(const BitBoard& board, int side, const MoveList& moves,
+                    CompactMove ttMove, int ply, int* scores) const;
+
+    // Moves the best remaining move to index, selection-sort style, so a
+    // cutoff early in the list skips sorting the rest
+    static void pickNext(MoveList& moves, int* scores, int index);
+
+    // A quiet move caused a beta cutoff: make it a killer and reward it in
+    // the history table, penalising the quiet moves tried before it
+    void recordCutoff(const MoveList& moves, int cutoffIndex, int side, int ply, int depth);
+
+    int historyScore(int side, int from, int to) const { return history[side][from][to]; }
+    bool isKiller(int ply, int from, int to) const;
+
+private:
+    static uint16_t killerKey(int from, int to) {
+        return static_cast<uint16_t>(from | (to << 5) | (1 << 10));
+    }
+
+    void updateHistory(int side, int from, int to, int bonus);
+
+    uint16_t killers[MAX_PLY][2];
+    int history[NUM_SIDES][NUM_SQUARES][NUM_SQUARES];
+};
+
+#endif // MOVEORDERING_H
@@ -0,0 +1,70 @@
+#ifndef MOVETABLES_H
+#define MOVETABLES_H
+
+#include <cstdint>
+#include "BitBoard.h"
+
+// Compile-time lookup tables for move generation on the 32-square board.
+//
+// All entries are single-bit square masks so generators can test them
+// against occupancy directly; a zero entry means "off the board", which
+// lets the inner loops run without any bounds checks.
+
+constexpr int MAX_RAY_LENGTH = 7;
+
+struct MoveTables {
+    // Adjacent square in each direction
+    uint32_t step[NUM_SQUARES][NUM_DIRECTIONS] = {};
+    // Landing square of a jump (two squares away) in each direction
+    uint32_t jump[NUM_SQUARES][NUM_DIRECTIONS] = {};
+    // Every square toward the board edge, nearest first, zero-terminated
+    uint32_t ray[NUM_SQUARES][NUM_DIRECTIONS][MAX_RAY_LENGTH + 1] = {};
+    // Union of the ray squares
+    uint32_t rayMask[NUM_SQUARES][NUM_DIRECTIONS] = {};
+    // Pion forward steps and jumps, indexed by side, square and left/right
+    uint32_t pionStep[NUM_SIDES][NUM_SQUARES][2] = {};
+    uint32_t pionJump[NUM_SIDES][NUM_SQUARES][2] = {};
+};
+
+// Forward directions of a Pion for each side, left before right.
+constexpr int PION_DIRECTIONS[NUM_SIDES][2] = {
+    {DOWN_LEFT, DOWN_RIGHT},
+    {UP_LEFT, UP_RIGHT},
+};
+
+constexpr MoveTables buildMoveTables() {
+    MoveTables tables{};
+    const int rowDelta[NUM_DIRECTIONS] = {1, 1, -1, -1};
+    const int colDelta[NUM_DIRECTIONS] = {1, -1, 1, -1};
+
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        int row = square >> 2;
+        int col = ((square & 3) << 1) | (row & 1);
+
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            int length = 0;
+            for (int r = row + rowDelta[dir], c = col + colDelta[dir];
+                 r >= 0 && r < 8 && c >= 0 && c < 8;
+                 r += rowDelta[dir], c += colDelta[dir]) {
+                uint32_t bit = 1u << (r * 4 + c / 2);
+                tables.ray[square][dir][length++] = bit;
+                tables.rayMask[square][dir] |= bit;
+            }
+            tables.step[square][dir] = tables.ray[square][dir][0];
+            tables.jump[square][dir] = tables.ray[square][dir][1];
+        }
+
+        for (int side = 0; side < NUM_SIDES; ++side) {
+            for (int i = 0; i < 2; ++i) {
+                tables.pionStep[side][square][i] = tables.step[square][PION_DIRECTIONS[side][i]];
+                tables.pionJump[side][square][i] = tables.jump[square][PION_DIRECTIONS[side][i]];
+            }
+        }
+    }
+
+    return tables;
+}
+
+inline constexpr MoveTables MOVE_TABLES = buildMoveTables();
+
+#endif // MOVETABLES_H
@@ -0,0 +1,101 @@
+#ifndef OPENINGBOOK_H
+#define OPENINGBOOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "CompactMove.h"
+#include "GameModel.h"
+#include "MappedFile.h"
+#include "Move.h"
+
+// Statistics of one move from one position, keyed by GameModel::getHash().
+// Results count from the point of view of the side playing the move.
+struct BookEntry {
+    uint64_t key;
+    uint32_t move;       // CompactMove::raw()
+    uint32_t plays;
+    uint32_t wins;
+    uint32_t losses;     // Draws are plays - wins - losses
+
+    uint32_t draws() const { return plays - wins - losses; }
+};
+
+static_assert(sizeof(BookEntry) == 24, "BookEntry layout must stay fixed");
+
+// Fixed header at the start of a book file, followed by the entries sorted
+// by key and then move. Fields are in host byte order.
+struct BookHeader {
+    char magic[4];       // "TCBK"
+    uint32_t version;
+    uint64_t entries;
+};
+
+static_assert(sizeof(BookHeader) == 16, "BookHeader layout must stay fixed");
+
+// Collects move statistics from finished games and writes a book file.
+class OpeningBookBuilder {
+public:
+    // Only the first maxPly moves of each game are recorded
+    explicit OpeningBookBuilder(int maxPly = 16) : maxPly(maxPly) {}
+
+    // Replays the moves from the start position. winner is the side that
+    // won, NO_SIDE for a draw. Recording stops at the first illegal move.
+    void addGame(const GameModel& start, const std::vector<Move>& moves, int winner);
+    void addGame(const GameModel& start, const std::vector<CompactMove>& moves, int winner);
+
+    size_t size() const { return stats.size(); }
+    size_t gameCount() const { return games; }
+
+    // Writes the entries played at least minPlays times
+    bool write(const std::string& path, uint32_t minPlays = 1) const;
+
+private:
+    struct Stats {
+        uint32_t plays = 0;
+        uint32_t wins = 0;
+        uint32_t losses = 0;
+    };
+
+    // Records one move of the game and plays it; false if it's illegal
+    bool addMove(GameModel& model, CompactMove move, int winner);
+
+    int maxPly;
+    size_t games = 0;
+    std::map<std::pair<uint64_t, uint32_t>, Stats> stats;   // Sorted as in the file
+};
+
+// Read side of the opening book: the file is memory-mapped and a lookup
+// is a binary search over its sorted entries.
+class OpeningBook {
+public:
+    static constexpr char MAGIC[4] = {'T', 'C', 'B', 'K'};
+    static constexpr uint32_t VERSION = 1;
+
+    // Returns false and leaves the book empty if the file isn't a valid book
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return file.isOpen(); }
+    size_t size() const { return count; }
+
+    // Entries of the position, in move order; empty when it's not in the book
+    std::vector<BookEntry> lookup(uint64_t key) const;
+
+    // The most played legal book move of the position, preferring the
+    // better score on ties. False when the book has no legal move for it.
+    bool probe(const GameModel& model, Move& move) const;
+
+private:
+    const BookEntry* entries() const {
+        return reinterpret_cast<const BookEntry*>(file.data() + sizeof(BookHeader));
+    }
+
+    MappedFile file;
+    size_t count = 0;
+};
+
+#endif // OPENINGBOOK_H
@@ -0,0 +1,66 @@
+#ifndef PERFT_H
+#define PERFT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "GameModel.h"
+#include "Move.h"
+#include "ThreadPool.h"
+
+// Move-generator node counting: the number of leaf positions reachable in
+// exactly `depth` moves. Positions where the side to move has no legal
+// move end the game and contribute no leaves below depth 0.
+//
+// Counting uses makeMove/unmakeMove on the given model, which is left
+// unchanged. With a hash size the counts of transposed subtrees are cached
+// by Zobrist key and depth.
+//
+// With more than one thread, every node with at least MIN_SPLIT_DEPTH
+// plies left is split into one task per move on a work-stealing pool; each
+// task counts on its own copy of the position. Child counts are summed in
+// move order, so results do not depend on scheduling. The hash table is
+// shared lock-free between threads.
+class Perft {
+public:
+    struct DivideEntry {
+        Move move;
+        uint64_t nodes;
+    };
+
+    // Smallest subtree handed to another thread; shallower ones are counted inline
+    static constexpr int MIN_SPLIT_DEPTH = 5;
+
+    // threads 0 uses one thread per hardware thread
+    explicit Perft(size_t hashMB = 0, unsigned threads = 1);
+
+    uint64_t count(GameModel& model, int depth);
+    std::vector<DivideEntry> divide(GameModel& model, int depth);
+
+    void clearHash();
+    bool isHashed() const { return tableSize != 0; }
+    unsigned threadCount() const { return pool ? pool->size() : 1; }
+
+private:
+    // Checked as in TranspositionTable: a torn slot fails key ^ data
+    struct HashEntry {
+        std::atomic<uint64_t> check{0};  // key ^ data
+        std::atomic<uint64_t> data{0};   // Leaf count in the low 56 bits, depth in the top 8
+    };
+
+    static constexpr int DEPTH_SHIFT = 56;
+    static constexpr uint64_t NODE_MASK = (1ull << DEPTH_SHIFT) - 1;
+
+    uint64_t countNode(GameModel& model, int depth);
+    uint64_t countSplit(GameModel& model, int depth);
+    bool probe(uint64_t key, int depth, uint64_t& nodes) const;
+    void store(uint64_t key, int depth, uint64_t nodes);
+
+    std::unique_ptr<HashEntry[]> table;
+    size_t tableSize = 0;
+    std::unique_ptr<ThreadPool> pool;
+};
+
+#endif // PERFT_H
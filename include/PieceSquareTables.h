@@ -0,0 +1,63 @@
+#ifndef PIECESQUARETABLES_H
+#define PIECESQUARETABLES_H
+
+#include <cstdint>
+#include "BitBoard.h"
+#include "Zobrist.h"
+
+// Material plus positional value of a piece on each square, from its
+// owner's point of view. GameModel keeps the per-side sums up to date as
+// moves are made, so evaluation never rescans the board for these terms.
+
+constexpr int NUM_ROWS = 8;
+
+constexpr int PION_VALUE = 100;
+constexpr int DAME_VALUE = 300;
+
+// Pion bonus by rows advanced toward the promotion row
+constexpr int PION_ADVANCE[NUM_ROWS] = {0, 0, 2, 5, 9, 14, 20, 0};
+
+// Pion still on its home row, where it stops enemy Pions from promoting
+constexpr int BACK_RANK_GUARD = 8;
+
+// Bonus by ring from the edge (0) to the four centre squares (3)
+constexpr int PION_CENTER[4] = {0, 0, 3, 5};
+constexpr int DAME_CENTER[4] = {0, 4, 8, 12};
+
+struct PieceSquareTables {
+    int value[NUM_SIDES][2][NUM_SQUARES] = {};  // [side][PieceKind][square]
+};
+
+constexpr PieceSquareTables buildPieceSquareTables() {
+    PieceSquareTables tables{};
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        for (int square = 0; square < NUM_SQUARES; ++square) {
+            int row = square >> 2;
+            int col = ((square & 3) << 1) | (row & 1);
+            int advanced = side == 0 ? row : NUM_ROWS - 1 - row;
+            int rowRing = row < NUM_ROWS - 1 - row ? row : NUM_ROWS - 1 - row;
+            int colRing = col < NUM_ROWS - 1 - col ? col : NUM_ROWS - 1 - col;
+            int ring = rowRing < colRing ? rowRing : colRing;
+
+            tables.value[side][PION_KIND][square] = PION_VALUE + PION_ADVANCE[advanced] +
+                                                    PION_CENTER[ring] +
+                                                    (advanced == 0 ? BACK_RANK_GUARD : 0);
+            tables.value[side][DAME_KIND][square] = DAME_VALUE + DAME_CENTER[ring];
+        }
+    }
+    return tables;
+}
+
+inline constexpr PieceSquareTables PIECE_SQUARE_TABLES = buildPieceSquareTables();
+
+// Full sum for one side; GameModel maintains the same value incrementally.
+inline int pieceSquareScore(const BitBoard& board, int side) {
+    int score = 0;
+    for (uint32_t mask = board.pieces[side]; mask; ) {
+        int square = popLowestSquare(mask);
+        score += PIECE_SQUARE_TABLES.value[side][(board.dames >> square) & 1u][square];
+    }
+    return score;
+}
+
+#endif // PIECESQUARETABLES_H
@@ -0,0 +1,65 @@
+#ifndef PLAYOUT_H
+#define PLAYOUT_H
+
+#include <cstdint>
+#include "BitBoard.h"
+#include "GameModel.h"
+#include "Zobrist.h"
+
+// xoshiro256** (Blackman and Vigna): a small, fast generator for
+// simulation workloads. Not for anything that needs unpredictability.
+class Xoshiro256 {
+public:
+    // The state is filled from the seed with splitmix64, so nearby seeds
+    // give unrelated streams
+    explicit Xoshiro256(uint64_t seed = 1) {
+        for (auto& word : state) word = splitMix64(seed);
+    }
+
+    uint64_t next() {
+        uint64_t result = rotate(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate(state[3], 45);
+        return result;
+    }
+
+    // Uniform in [0, bound) by multiply-shift on the high 32 bits; the bias
+    // is below bound / 2^32
+    uint32_t below(uint32_t bound) {
+        return static_cast<uint32_t>(((next() >> 32) * bound) >> 32);
+    }
+
+private:
+    static uint64_t rotate(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    uint64_t state[4];
+};
+
+constexpr int DEFAULT_PLAYOUT_PLIES = 300;
+
+struct PlayoutResult {
+    int winner = NO_SIDE;   // NO_SIDE when the ply limit was reached
+    int plies = 0;
+};
+
+// Plays the position to the end with uniformly random legal moves: the
+// side to move with no legal move loses, and a game still running after
+// maxPlies is a draw.
+//
+// Works on a bitboard copy with its own move generator, which keeps only
+// origin, destination and captured mask of each move in a stack array: no
+// Move objects, no hash or history updates, no allocation. Moves are
+// generated in GameModel::generateMoves order and picked with
+// rng.below(count), so the game is exactly the one generateMoves and
+// makeMove would play with the same generator.
+PlayoutResult randomPlayout(const BitBoard& board, int sideToMove, Xoshiro256& rng,
+                            int maxPlies = DEFAULT_PLAYOUT_PLIES);
+PlayoutResult randomPlayout(const GameModel& model, Xoshiro256& rng,
+                            int maxPlies = DEFAULT_PLAYOUT_PLIES);
+
+#endif // PLAYOUT_H
@@ -0,0 +1,134 @@
+#ifndef SEARCHENGINE_H
+#define SEARCHENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "CompactMove.h"
+#include "GameModel.h"
+#include "Move.h"
+#include "MoveOrdering.h"
+#include "OpeningBook.h"
+#include "Tablebase.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+
+// Budget for one search; a zero node or time limit means unlimited
+struct SearchLimits {
+    int maxDepth = 64;
+    uint64_t maxNodes = 0;       // Summed over all search threads
+    int64_t maxTimeMs = 0;
+};
+
+struct SearchResult {
+    Move bestMove;               // Empty path when the side to move has no move
+    int score = 0;               // From the side to move's point of view
+    int depth = 0;               // Last fully searched depth
+    uint64_t nodes = 0;          // Summed over all search threads
+    double seconds = 0.0;
+    std::vector<Move> pv;        // Principal variation, starting with bestMove
+    bool fromBook = false;       // Played from the opening book without searching
+
+    bool hasMove() const { return !bestMove.path.empty(); }
+};
+
+// Game-tree search over GameModel's make/unmake interface: negamax
+// alpha-beta with principal variation search, driven by iterative
+// deepening and backed by a transposition table. Moves are tried in
+// MoveOrdering's order. At the depth horizon a quiescence search keeps
+// following capture sequences, which are forced, and only scores
+// positions where the side to move has no capture.
+//
+// Scores are in centi-pions from the side to move's point of view, with
+// positions scored by Evaluation. A side
+// with no legal move loses, scored as -MATE_SCORE plus its distance from
+// the root, so quicker wins score higher. When the budget runs out the
+// result of the last completed iteration is returned.
+//
+// With more than one thread the search is Lazy SMP: helper threads run
+// their own iterative deepening on the same root, skipping depths in a
+// staggered pattern, and share results only through the transposition
+// table. Each thread searches its own copy of the position. The calling
+// thread's iterations decide the result and end the search, so a
+// one-thread search is fully deterministic.
+//
+// With an OpeningBook set, a root position found in the book is answered
+// with its book move and not searched at all. With a Tablebase set,
+// positions below the root that it holds are scored from the table
+// instead of searched: wins and losses as mates at the tabled distance,
+// draws as 0.
+class SearchEngine {
+public:
+    static constexpr int MAX_PLY = MoveOrdering::MAX_PLY;
+    static constexpr int INFINITE_SCORE = 32000;
+    static constexpr int MATE_SCORE = 30000;
+    static constexpr int MATE_BOUND = MATE_SCORE - MAX_PLY;  // Scores beyond this are mates
+
+    // threads 0 uses one thread per hardware thread
+    explicit SearchEngine(size_t hashMB = 16, unsigned threads = 1);
+    ~SearchEngine();
+
+    // Searches copies of the model; the model itself is not touched
+    SearchResult search(const GameModel& model, const SearchLimits& limits);
+
+    // Ends a running search from another thread
+    void stop() { stopSignal.store(true, std::memory_order_relaxed); }
+
+    // Not safe during a search
+    void setThreads(unsigned threads);
+    unsigned threadCount() const { return static_cast<unsigned>(threads.size()); }
+
+    // Null to search without them; both must outlive their use here.
+    // Not safe during a search.
+    void setOpeningBook(const OpeningBook* openingBook) { book = openingBook; }
+    void setTablebase(const Tablebase* tables) { tablebase = tables; }
+
+    void clearHash() { table.clear(); }
+    TranspositionTable& getTable() { return table; }
+
+    static bool isMateScore(int score) { return score > MATE_BOUND || score < -MATE_BOUND; }
+
+private:
+    // Everything one search thread writes while searching
+    struct SearchThread {
+        int id = 0;
+        GameModel position;
+        uint64_t nodes = 0;
+        uint64_t flushedNodes = 0;      // Part of nodes already added to sharedNodes
+        bool stopped = false;
+        MoveOrdering ordering;          // Killers and history; cleared each search
+
+        uint64_t keyStack[MAX_PLY + 1] = {};            // Position keys along the current line
+        CompactMove pvTable[MAX_PLY + 1][MAX_PLY + 1];  // Triangular PV table
+        int pvLength[MAX_PLY + 1] = {};
+    };
+
+    void iterate(SearchThread& thread, SearchResult* result);
+    int negamax(SearchThread& thread, int depth, int ply, int alpha, int beta);
+    int quiescence(SearchThread& thread, int ply, int alpha, int beta);
+    int evaluate(const SearchThread& thread) const;
+    bool isRepetition(const SearchThread& thread, int ply) const;
+    bool probeTablebase(const SearchThread& thread, int ply, int& score) const;
+    bool shouldStop(SearchThread& thread);
+    void updatePv(SearchThread& thread, int ply, CompactMove move);
+    std::vector<Move> extractPv(const SearchThread& thread) const;
+
+    static int toTableScore(int score, int ply);
+    static int fromTableScore(int score, int ply);
+
+    TranspositionTable table;
+    std::vector<std::unique_ptr<SearchThread>> threads;
+    std::unique_ptr<ThreadPool> pool;   // Runs the helper threads
+    const OpeningBook* book = nullptr;
+    const Tablebase* tablebase = nullptr;
+
+    SearchLimits limits;
+    std::chrono::steady_clock::time_point startTime;
+    std::atomic<bool> stopSignal{false};
+    std::atomic<uint64_t> sharedNodes{0};
+};
+
+#endif // SEARCHENGINE_H
@@ -0,0 +1,110 @@
+#ifndef SELFPLAY_H
+#define SELFPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "CompactMove.h"
+#include "GameModel.h"
+#include "MoveList.h"
+#include "SearchEngine.h"
+
+// Picks a move for one side of a self-play game. Each game gets its own
+// policy objects, so a policy may keep state between its moves.
+class MovePolicy {
+public:
+    virtual ~MovePolicy() = default;
+
+    // Index into moves, which holds the legal moves of the position and
+    // is never empty. Randomness must come from rng to keep games
+    // reproducible.
+    virtual int select(const GameModel& model, const MoveList& moves, std::mt19937_64& rng) = 0;
+};
+
+// Uniformly random legal move
+class RandomPolicy : public MovePolicy {
+public:
+    int select(const GameModel& model, const MoveList& moves, std::mt19937_64& rng) override;
+};
+
+// First move in generator order; fully deterministic
+class FirstLegalPolicy : public MovePolicy {
+public:
+    int select(const GameModel& model, const MoveList& moves, std::mt19937_64& rng) override;
+};
+
+// SearchEngine's best move on one thread with a small table
+class SearchPolicy : public MovePolicy {
+public:
+    explicit SearchPolicy(const SearchLimits& limits, size_t hashMB = 1);
+    int select(const GameModel& model, const MoveList& moves, std::mt19937_64& rng) override;
+
+private:
+    SearchEngine engine;
+    SearchLimits limits;
+};
+
+using PolicyFactory = std::function<std::unique_ptr<MovePolicy>()>;
+
+// Factory for "random", "first" or "search"; an empty factory for any other name
+PolicyFactory makePolicyFactory(const std::string& name, const SearchLimits& limits = SearchLimits());
+
+struct SelfPlayConfig {
+    uint64_t games = 1000;
+    uint64_t seed = 1;
+    int maxPlies = 300;          // Games still running after this many plies are draws
+    unsigned threads = 0;        // 0 uses one thread per hardware thread
+};
+
+struct GameRecord {
+    uint64_t index = 0;
+    int winner = NO_SIDE;        // NO_SIDE for a draw
+    std::vector<CompactMove> moves;
+};
+
+// Plays independent games from the standard start on a work-stealing
+// ThreadPool. Game i draws its randomness from its own generator, seeded
+// from the configured seed and i, so every record depends only on the
+// configuration, never on thread count or scheduling.
+//
+// Finished games are handed to the sink in game order, one at a time, as
+// soon as every earlier game has finished; out-of-order games wait in a
+// bounded reorder buffer, and no game starts more than its size ahead of
+// the next one due. The sink runs without the runner's lock held, so
+// other threads keep playing while it writes. The runner itself does no
+// console I/O.
+class SelfPlayRunner {
+public:
+    using Sink = std::function<void(const GameRecord&)>;
+
+    struct Summary {
+        uint64_t games = 0;
+        uint64_t wins[NUM_SIDES] = {0, 0};
+        uint64_t draws = 0;
+        uint64_t plies = 0;
+    };
+
+    // Games in flight or waiting for an earlier one, which bounds the reorder buffer
+    static constexpr uint64_t WINDOW_SIZE = 256;
+
+    SelfPlayRunner(PolicyFactory player1, PolicyFactory player2);
+
+    Summary run(const SelfPlayConfig& config, const Sink& sink);
+
+    // One game on the calling thread
+    GameRecord playGame(uint64_t index, const SelfPlayConfig& config) const;
+
+    // Text form of a record: index, result ("1-0", "0-1" or "1/2") and ply
+    // count, then the moves as "from-to" or "fromxto" square numbers
+    static void write(std::ostream& out, const GameRecord& record);
+
+private:
+    PolicyFactory factories[NUM_SIDES];
+};
+
+#endif // SELFPLAY_H
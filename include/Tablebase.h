@@ -0,0 +1,122 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include "BitBoard.h"
+#include "GameModel.h"
+#include "MappedFile.h"
+
+// Piece counts of a position: every position with the same counts belongs
+// to one table.
+struct Material {
+    int pions[NUM_SIDES] = {0, 0};
+    int dames[NUM_SIDES] = {0, 0};
+
+    static Material of(const BitBoard& board);
+
+    int pieces(int side) const { return pions[side] + dames[side]; }
+    int total() const { return pieces(0) + pieces(1); }
+
+    // Four bits per count: pions[0], dames[0], pions[1], dames[1]
+    uint32_t key() const {
+        return static_cast<uint32_t>(pions[0] | (dames[0] << 4) | (pions[1] << 8) | (dames[1] << 12));
+    }
+
+    // File name of the table, e.g. "x2X0o0O1.tb" for two Player1 Pions
+    // against one Player2 Dame (the letters of perft --board)
+    std::string fileName() const;
+
+    bool operator==(const Material& other) const { return key() == other.key(); }
+    bool operator!=(const Material& other) const { return key() != other.key(); }
+};
+
+// Perfect index of the positions of one Material.
+//
+// Pieces are placed group by group: Player1 Pions, Player2 Pions, Player1
+// Dames, Player2 Dames. Each group is ranked as a combination of the
+// squares the earlier groups left free, so every placement of the pieces
+// gets exactly one index in [0, size / 2) and every index decodes to a
+// placement. The side to move is the lowest bit. Placements with a Pion
+// on its promotion row can't occur in play; they have an index but are
+// never probed.
+class TablebaseIndex {
+public:
+    static uint64_t size(const Material& material);
+
+    // The board must hold exactly the table's material
+    static uint64_t index(const BitBoard& board, int side);
+
+    static void position(const Material& material, uint64_t index, BitBoard& board, int& side);
+
+    // False when a Pion stands on the row it would have promoted on
+    static bool isReachable(const BitBoard& board);
+};
+
+// One byte per position, from the side to move's point of view: 0 is a
+// draw, 1..127 a win in that many plies, 128 + n a loss in n plies.
+// Distances beyond MAX_DISTANCE are stored as MAX_DISTANCE.
+namespace TablebaseValue {
+    constexpr int MAX_DISTANCE = 127;
+    constexpr uint8_t DRAW = 0;
+    constexpr uint8_t LOSS_BASE = 128;
+
+    inline uint8_t win(int plies) { return static_cast<uint8_t>(plies < MAX_DISTANCE ? plies : MAX_DISTANCE); }
+    inline uint8_t loss(int plies) { return static_cast<uint8_t>(LOSS_BASE + (plies < MAX_DISTANCE ? plies : MAX_DISTANCE)); }
+    inline bool isWin(uint8_t value) { return value != DRAW && value < LOSS_BASE; }
+    inline bool isLoss(uint8_t value) { return value >= LOSS_BASE; }
+    inline int distance(uint8_t value) { return value >= LOSS_BASE ? value - LOSS_BASE : value; }
+}
+
+// Fixed header at the start of every table file, followed by one value
+// byte per index. Fields are in host byte order.
+struct TablebaseHeader {
+    char magic[4];               // "TCTB"
+    uint32_t version;
+    uint8_t pions[NUM_SIDES];
+    uint8_t dames[NUM_SIDES];
+    uint32_t reserved;
+    uint64_t entries;
+};
+
+static_assert(sizeof(TablebaseHeader) == 24, "TablebaseHeader layout must stay fixed");
+
+// Read side of the endgame tablebase. open() memory-maps every table file
+// of a directory; probing then costs one index computation and one byte
+// read, with pages loaded on first touch.
+class Tablebase {
+public:
+    enum class Outcome { Draw, Win, Loss };
+
+    struct Result {
+        Outcome outcome = Outcome::Draw;
+        int distance = 0;        // Plies to the end of the game with best play
+    };
+
+    static constexpr char MAGIC[4] = {'T', 'C', 'T', 'B'};
+    static constexpr uint32_t VERSION = 1;
+
+    // Maps all valid table files in the directory and returns how many
+    // were found. A file is skipped unless its header holds at most
+    // TablebaseGenerator::MAX_PIECES pieces, it is named after that
+    // material and its size matches the index. Tables already open stay open.
+    int open(const std::string& directory);
+    void close();
+
+    // Number of pieces of the largest table, 0 when none is open
+    int maxPieces() const { return largest; }
+    size_t tableCount() const { return tables.size(); }
+    bool hasTable(const Material& material) const { return tables.count(material.key()) != 0; }
+
+    // False when no table holds the position
+    bool probe(const BitBoard& board, int side, Result& result) const;
+    bool probe(const GameModel& model, Result& result) const;
+
+private:
+    std::unordered_map<uint32_t, MappedFile> tables;
+    int largest = 0;
+};
+
+#endif // TABLEBASE_H
@@ -0,0 +1,67 @@
+#ifndef TABLEBASEGENERATOR_H
+#define TABLEBASEGENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Tablebase.h"
+#include "ThreadPool.h"
+
+// Builds the tables read by Tablebase by retrograde analysis.
+//
+// Captures and promotions always lead to a different Material: a capture
+// removes a piece, a promotion turns a Pion into a Dame. Materials are
+// solved in order of piece count and then Pion count, so every position
+// such a move reaches is already solved. Within one Material only quiet
+// moves remain; the generator follows them forward once to count each
+// position's successors and collect its predecessors, then resolves
+// positions in order of distance:
+//
+//   - a position with no legal move is lost in 0
+//   - a position with a successor lost in n is won in n + 1 at best
+//   - a position whose successors are all won is lost in 1 + the longest
+//
+// Positions never resolved can avoid defeat forever and are draws. The
+// forward pass is split over a ThreadPool; the backward pass is serial.
+class TablebaseGenerator {
+public:
+    // Position indices inside a Material are solved as 32-bit values. The
+    // largest 7-piece Material has about 4.2e9 positions; 8 pieces don't fit.
+    static constexpr int MAX_PIECES = 7;
+    static constexpr uint64_t MAX_MATERIAL_SIZE = UINT32_MAX;
+
+    // threads 0 uses one thread per hardware thread
+    explicit TablebaseGenerator(unsigned threads = 1);
+    ~TablebaseGenerator();
+
+    // Every Material with 1..maxPieces pieces per side and at most
+    // maxPieces in total, in solving order
+    static std::vector<Material> materials(int maxPieces);
+
+    // Solves every Material up to maxPieces and writes one file per
+    // Material into the directory. Returns false if a Material can't be
+    // solved or a file can't be written.
+    bool generate(int maxPieces, const std::string& directory);
+
+    // Solves one Material; every Material its captures and promotions
+    // lead to must already be solved. Returns an empty table, without
+    // solving, for a Material of more than MAX_MATERIAL_SIZE positions.
+    const std::vector<uint8_t>& solve(const Material& material);
+
+    bool isSolved(const Material& material) const { return solved.count(material.key()) != 0; }
+    bool write(const Material& material, const std::string& directory) const;
+
+private:
+    struct Chunk;
+
+    void expand(const Material& material, Chunk& chunk, uint64_t begin, uint64_t end) const;
+    uint8_t lookup(const BitBoard& board, int side) const;
+
+    std::unique_ptr<ThreadPool> pool;
+    std::unordered_map<uint32_t, std::vector<uint8_t>> solved;
+};
+
+#endif // TABLEBASEGENERATOR_H
@@ -0,0 +1,78 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool for recursive, fork-join style workloads.
+//
+// Each worker owns a deque: tasks it submits go to the back and it takes
+// work from the back (newest first, good locality), while idle workers
+// steal from the front (oldest first, usually the largest subtrees).
+// Tasks submitted from outside the pool go to a shared injection queue.
+//
+// wait() runs the group's own queued tasks, and steals others up to a
+// nesting limit, while the group is unfinished, so tasks can submit and
+// wait on nested groups without deadlocking the pool. Tasks must not throw.
+class ThreadPool {
+public:
+    class TaskGroup {
+    public:
+        TaskGroup() : pending(0) {}
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class ThreadPool;
+        std::atomic<int> pending;
+    };
+
+    // threadCount 0 uses one worker per hardware thread
+    explicit ThreadPool(unsigned threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()); }
+
+    void submit(TaskGroup& group, std::function<void()> task);
+    void wait(TaskGroup& group);
+
+private:
+    struct Task {
+        std::function<void()> run;
+        TaskGroup* group = nullptr;
+    };
+
+    struct alignas(64) WorkQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    int currentWorker() const;
+    bool popTask(int self, Task& task);
+    bool popGroupTask(int self, TaskGroup& group, Task& task);
+    bool stealTask(int self, Task& task);
+    void runTask(Task& task);
+    void workerLoop(int index);
+
+    // One queue per worker, followed by the injection queue
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    std::atomic<int> queuedTasks{0};
+    std::atomic<bool> stopping{false};
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,100 @@
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "CompactMove.h"
+
+// Fixed-size transposition table keyed by GameModel::getHash(), shared by
+// any number of search threads without locks.
+//
+// Each slot holds two 64-bit words: the packed entry data and the key XORed
+// with that data. A reader accepts a slot only when the XOR of the two words
+// gives back its key, so an entry torn by a concurrent writer reads as a
+// miss instead of as corrupt data. Slots are grouped in cache-line buckets
+// of four; a store replaces the slot of the same position if present,
+// otherwise the one with the least depth left after penalising entries
+// from older searches.
+class TranspositionTable {
+public:
+    enum class Bound : uint8_t { None = 0, Exact = 1, Lower = 2, Upper = 3 };
+
+    struct Entry {
+        CompactMove bestMove;
+        int score = 0;
+        int depth = 0;
+        Bound bound = Bound::None;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;        // Probes that found their position
+        uint64_t misses = 0;      // Probes that found nothing
+        uint64_t collisions = 0;  // Stores that evicted a different position
+        uint64_t stores = 0;
+    };
+
+    static constexpr int MAX_DEPTH = 127;
+    static constexpr int MAX_AGE = 63;
+
+    explicit TranspositionTable(size_t sizeMB = 16);
+
+    // Reallocates and clears the table. Not safe while other threads use it.
+    void resize(size_t sizeMB);
+    void clear();
+
+    // Starts a new search generation; older entries become cheaper to replace
+    void newSearch();
+
+    bool probe(uint64_t key, Entry& entry) const;
+    void store(uint64_t key, int depth, int score, Bound bound, CompactMove bestMove);
+    void prefetch(uint64_t key) const;
+
+    size_t sizeMB() const { return megabytes; }
+    size_t capacity() const { return bucketCount * BUCKET_SLOTS; }
+    int getAge() const { return age.load(std::memory_order_relaxed); }
+
+    Stats getStats() const;
+    void resetStats();
+
+    // Per-mille of the first thousand slots used by the current search
+    int hashfull() const;
+
+private:
+    static constexpr int BUCKET_SLOTS = 4;
+    static constexpr int STAT_STRIPES = 16;
+
+    struct Slot {
+        std::atomic<uint64_t> check;  // key ^ data
+        std::atomic<uint64_t> data;
+    };
+
+    struct alignas(64) Bucket {
+        Slot slots[BUCKET_SLOTS];
+    };
+
+    // Counters are striped by key so threads rarely share a cache line
+    struct alignas(64) StatStripe {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> collisions{0};
+        std::atomic<uint64_t> stores{0};
+    };
+
+    static uint64_t pack(CompactMove move, int score, int depth, Bound bound, int age);
+    static Entry unpack(uint64_t data);
+    static int ageOf(uint64_t data) { return static_cast<int>(data >> 58); }
+    static int depthOf(uint64_t data) { return static_cast<int>((data >> 48) & 0xFF); }
+
+    Bucket& bucketFor(uint64_t key) const { return buckets[key & (bucketCount - 1)]; }
+    StatStripe& stripeFor(uint64_t key) const { return stats[(key >> 59) & (STAT_STRIPES - 1)]; }
+
+    std::unique_ptr<Bucket[]> buckets;
+    size_t bucketCount = 0;
+    size_t megabytes = 0;
+    std::atomic<int> age{0};
+    mutable StatStripe stats[STAT_STRIPES];
+};
+
+#endif // TRANSPOSITIONTABLE_H
@@ -0,0 +1,52 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstdint>
+#include "BitBoard.h"
+
+// Zobrist keys for position hashing, generated at compile time with
+// splitmix64 so every build produces the same keys.
+
+enum PieceKind { PION_KIND = 0, DAME_KIND = 1 };
+
+struct ZobristKeys {
+    uint64_t piece[NUM_SIDES][2][NUM_SQUARES] = {};  // [side][PieceKind][square]
+    uint64_t sideToMove = 0;                         // XORed in when side 1 is to move
+};
+
+constexpr uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr ZobristKeys buildZobristKeys() {
+    ZobristKeys keys{};
+    uint64_t state = 0x5448414943484B52ull;
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        for (int kind = 0; kind < 2; ++kind) {
+            for (int square = 0; square < NUM_SQUARES; ++square) {
+                keys.piece[side][kind][square] = splitMix64(state);
+            }
+        }
+    }
+    keys.sideToMove = splitMix64(state);
+    return keys;
+}
+
+inline constexpr ZobristKeys ZOBRIST_KEYS = buildZobristKeys();
+
+// Full hash of a position; GameModel maintains the same value incrementally.
+inline uint64_t zobristHash(const BitBoard& board, int sideToMove) {
+    uint64_t hash = sideToMove == 1 ? ZOBRIST_KEYS.sideToMove : 0;
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        for (uint32_t mask = board.pieces[side]; mask; ) {
+            int square = popLowestSquare(mask);
+            hash ^= ZOBRIST_KEYS.piece[side][(board.dames >> square) & 1u][square];
+        }
+    }
+    return hash;
+}
+
+#endif // ZOBRIST_H
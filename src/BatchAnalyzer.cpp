@@ -0,0 +1,176 @@
+#include "BatchAnalyzer.h"
+#include "MoveList.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace {
+    // A position in flight: its input line, then its result
+    struct Slot {
+        std::string line;
+        PositionAnalysis result;
+        bool done = false;
+    };
+}
+
+BatchAnalyzer::BatchAnalyzer(const AnalysisConfig& analysisConfig) : config(analysisConfig) {
+    config.queueSize = std::max<size_t>(config.queueSize, 1);
+}
+
+void BatchAnalyzer::analyze(const std::string& line, GameModel& model, SearchEngine* engine,
+                            const SearchLimits& limits, PositionAnalysis& result) {
+    result.moves.clear();
+    result.gameOver = false;
+    result.winner = NO_SIDE;
+    result.searched = false;
+    result.bestMove = CompactMove();
+    result.score = 0;
+    result.depth = 0;
+
+    size_t length = line.size();
+    while (length > 0 && std::isspace(static_cast<unsigned char>(line[length - 1]))) --length;
+    result.valid = model.fromNotation(line.data(), length);
+    if (!result.valid) return;
+
+    MoveList legal;
+    model.generateMoves(legal);
+    for (const auto& entry : legal) result.moves.push_back(model.encodeMove(entry));
+    if (legal.empty()) {
+        result.gameOver = true;
+        result.winner = model.getCurrentSide() == 0 ? 1 : 0;
+        return;
+    }
+
+    if (!engine) return;
+    engine->clearHash();
+    SearchResult searchResult = engine->search(model, limits);
+    result.searched = searchResult.hasMove();
+    if (result.searched) {
+        result.bestMove = model.encodeMove(searchResult.bestMove);
+        result.score = searchResult.score;
+        result.depth = searchResult.depth;
+    }
+}
+
+void BatchAnalyzer::write(std::ostream& out, const PositionAnalysis& result) {
+    out << result.index;
+    if (!result.valid) {
+        out << " invalid\n";
+        return;
+    }
+    out << ' ' << (!result.gameOver ? "*" : result.winner == 0 ? "1-0" : "0-1") << ' ' << result.moves.size();
+    for (const auto& move : result.moves) {
+        out << ' ' << move.from() << (move.isCapture() ? 'x' : '-') << move.to();
+    }
+    if (result.searched) {
+        out << " best " << result.bestMove.from() << (result.bestMove.isCapture() ? 'x' : '-')
+            << result.bestMove.to() << " score " << result.score << " depth " << result.depth;
+    }
+    out << '\n';
+}
+
+BatchAnalyzer::Summary BatchAnalyzer::run(const Source& source, const Sink& sink) {
+    Summary summary;
+    auto deliver = [&](const PositionAnalysis& result) {
+        ++summary.positions;
+        if (!result.valid) ++summary.invalid;
+        if (result.gameOver) ++summary.gameOver;
+        if (sink) sink(result);
+    };
+    auto makeEngine = [&]() {
+        return config.search ? std::make_unique<SearchEngine>(config.hashMB, 1) : nullptr;
+    };
+
+    std::unique_ptr<ThreadPool> pool;
+    if (config.threads != 1) {
+        pool = std::make_unique<ThreadPool>(config.threads);
+        if (pool->size() == 1) pool.reset();
+    }
+    if (!pool) {
+        GameModel model;
+        std::unique_ptr<SearchEngine> engine = makeEngine();
+        std::string line;
+        PositionAnalysis result;
+        for (uint64_t i = 0; source(line); ++i) {
+            result.index = i;
+            analyze(line, model, engine.get(), config.limits, result);
+            deliver(result);
+        }
+        return summary;
+    }
+
+    // Positions nextDue..nextRead-1 are in flight, each in slot index % size:
+    // workers take them in input order and the next one due is delivered
+    // as soon as it's done. The reader waits for a free slot before reading.
+    std::vector<Slot> slots(config.queueSize);
+    std::mutex mutex;
+    std::condition_variable workReady;
+    std::condition_variable slotFree;
+    uint64_t nextRead = 0;
+    uint64_t nextTaken = 0;
+    uint64_t nextDue = 0;
+    bool inputDone = false;
+    bool delivering = false;
+
+    auto work = [&]() {
+        GameModel model;
+        std::unique_ptr<SearchEngine> engine = makeEngine();
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            workReady.wait(lock, [&]() { return nextTaken < nextRead || inputDone; });
+            if (nextTaken == nextRead) return;
+
+            uint64_t index = nextTaken++;
+            Slot& slot = slots[index % slots.size()];
+            lock.unlock();
+            slot.result.index = index;
+            analyze(slot.line, model, engine.get(), config.limits, slot.result);
+            lock.lock();
+            slot.done = true;
+
+            // One worker at a time delivers, outside the lock, so the sink
+            // never blocks the others from taking work
+            if (delivering) continue;
+            delivering = true;
+            while (nextDue < nextTaken && slots[nextDue % slots.size()].done) {
+                Slot& due = slots[nextDue % slots.size()];
+                lock.unlock();
+                deliver(due.result);
+                lock.lock();
+                due.done = false;
+                ++nextDue;
+                slotFree.notify_one();
+            }
+            delivering = false;
+        }
+    };
+
+    ThreadPool::TaskGroup group;
+    for (unsigned i = 0; i < pool->size(); ++i) pool->submit(group, work);
+
+    while (true) {
+        Slot* slot;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            slotFree.wait(lock, [&]() { return nextRead - nextDue < slots.size(); });
+            slot = &slots[nextRead % slots.size()];
+        }
+        // The slot is free until nextRead moves past it
+        if (!source(slot->line)) break;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++nextRead;
+        }
+        workReady.notify_one();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        inputDone = true;
+    }
+    workReady.notify_all();
+    pool->wait(group);
+    return summary;
+}
@@ -0,0 +1,282 @@
+#include "BatchEvaluation.h"
+#include "Evaluation.h"
+#include "MoveTables.h"
+#include "PieceSquareTables.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define THAI_CHECKERS_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+void PositionBatch::clear() {
+    player1.clear();
+    player2.clear();
+    dames.clear();
+    sideToMove.clear();
+}
+
+void PositionBatch::reserve(size_t count) {
+    player1.reserve(count);
+    player2.reserve(count);
+    dames.reserve(count);
+    sideToMove.reserve(count);
+}
+
+bool PositionBatch::add(const BitBoard& board, int side) {
+    if (side != 0 && side != 1) return false;
+    player1.push_back(board.pieces[0]);
+    player2.push_back(board.pieces[1]);
+    dames.push_back(board.dames);
+    sideToMove.push_back(static_cast<uint8_t>(side));
+    return true;
+}
+
+bool PositionBatch::add(const GameModel& model) {
+    return add(model.getBitBoard(), model.getCurrentSide());
+}
+
+namespace {
+    constexpr int PION = PION_KIND;
+    constexpr int DAME = DAME_KIND;
+
+    void evaluateScalar(const PositionBatch& batch, size_t begin, size_t end, int32_t* scores) {
+        for (size_t i = begin; i < end; ++i) {
+            BitBoard board;
+            board.pieces[0] = batch.player1[i];
+            board.pieces[1] = batch.player2[i];
+            board.dames = batch.dames[i];
+
+            int score = pieceSquareScore(board, 0) - pieceSquareScore(board, 1) +
+                        Evaluation::MOBILITY_WEIGHT *
+                            (Evaluation::mobility(board, 0) - Evaluation::mobility(board, 1));
+            scores[i] = batch.sideToMove[i] ? -score : score;
+        }
+    }
+
+#ifdef THAI_CHECKERS_X86_KERNELS
+    // The vector kernels follow shiftSquares() and Evaluation::mobility()
+    // lane by lane; see BitBoard.h for the masks.
+
+    // ---- SSE2: four positions per step ----
+
+    __attribute__((target("sse2"))) inline __m128i shift4(__m128i mask, int direction) {
+        const __m128i even = _mm_set1_epi32(static_cast<int>(BitMasks::EVEN_ROWS));
+        const __m128i odd = _mm_set1_epi32(static_cast<int>(BitMasks::ODD_ROWS));
+        const __m128i notLeft = _mm_set1_epi32(static_cast<int>(~BitMasks::LEFT_EDGE));
+        const __m128i notRight = _mm_set1_epi32(static_cast<int>(~BitMasks::RIGHT_EDGE));
+        __m128i evenPart = _mm_and_si128(mask, even);
+        __m128i oddPart = _mm_and_si128(mask, odd);
+        switch (direction) {
+            case DOWN_RIGHT:
+                return _mm_or_si128(_mm_slli_epi32(evenPart, 4), _mm_slli_epi32(_mm_and_si128(oddPart, notRight), 5));
+            case DOWN_LEFT:
+                return _mm_or_si128(_mm_slli_epi32(_mm_and_si128(evenPart, notLeft), 3), _mm_slli_epi32(oddPart, 4));
+            case UP_RIGHT:
+                return _mm_or_si128(_mm_srli_epi32(evenPart, 4), _mm_srli_epi32(_mm_and_si128(oddPart, notRight), 3));
+            default:
+                return _mm_or_si128(_mm_srli_epi32(_mm_and_si128(evenPart, notLeft), 5), _mm_srli_epi32(oddPart, 4));
+        }
+    }
+
+    __attribute__((target("sse2"))) inline __m128i popCount4(__m128i x) {
+        x = _mm_sub_epi32(x, _mm_and_si128(_mm_srli_epi32(x, 1), _mm_set1_epi32(0x55555555)));
+        x = _mm_add_epi32(_mm_and_si128(x, _mm_set1_epi32(0x33333333)),
+                          _mm_and_si128(_mm_srli_epi32(x, 2), _mm_set1_epi32(0x33333333)));
+        x = _mm_and_si128(_mm_add_epi32(x, _mm_srli_epi32(x, 4)), _mm_set1_epi32(0x0F0F0F0F));
+        x = _mm_add_epi32(x, _mm_srli_epi32(x, 8));
+        x = _mm_add_epi32(x, _mm_srli_epi32(x, 16));
+        return _mm_and_si128(x, _mm_set1_epi32(0x3F));
+    }
+
+    __attribute__((target("sse2"))) inline __m128i mobility4(__m128i own, __m128i dames, __m128i empty, int side) {
+        __m128i pions = _mm_andnot_si128(dames, own);
+        __m128i ownDames = _mm_and_si128(dames, own);
+        __m128i steps = _mm_setzero_si128();
+        for (int dir : PION_DIRECTIONS[side]) {
+            steps = _mm_add_epi32(steps, popCount4(_mm_and_si128(shift4(pions, dir), empty)));
+        }
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            steps = _mm_add_epi32(steps, popCount4(_mm_and_si128(shift4(ownDames, dir), empty)));
+        }
+        return steps;
+    }
+
+    __attribute__((target("sse2")))
+    size_t evaluateSse2(const PositionBatch& batch, int32_t* scores) {
+        const auto& table = PIECE_SQUARE_TABLES.value;
+        size_t count = batch.size() & ~static_cast<size_t>(3);
+
+        for (size_t i = 0; i < count; i += 4) {
+            __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&batch.player1[i]));
+            __m128i p2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&batch.player2[i]));
+            __m128i dames = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&batch.dames[i]));
+
+            __m128i score1 = _mm_setzero_si128();
+            __m128i score2 = _mm_setzero_si128();
+            for (int square = 0; square < NUM_SQUARES; ++square) {
+                __m128i bit = _mm_set1_epi32(static_cast<int>(1u << square));
+                __m128i isDame = _mm_cmpeq_epi32(_mm_and_si128(dames, bit), bit);
+                __m128i own1 = _mm_cmpeq_epi32(_mm_and_si128(p1, bit), bit);
+                __m128i own2 = _mm_cmpeq_epi32(_mm_and_si128(p2, bit), bit);
+
+                __m128i value1 = _mm_add_epi32(_mm_set1_epi32(table[0][PION][square]),
+                    _mm_and_si128(isDame, _mm_set1_epi32(table[0][DAME][square] - table[0][PION][square])));
+                __m128i value2 = _mm_add_epi32(_mm_set1_epi32(table[1][PION][square]),
+                    _mm_and_si128(isDame, _mm_set1_epi32(table[1][DAME][square] - table[1][PION][square])));
+                score1 = _mm_add_epi32(score1, _mm_and_si128(own1, value1));
+                score2 = _mm_add_epi32(score2, _mm_and_si128(own2, value2));
+            }
+
+            __m128i empty = _mm_xor_si128(_mm_or_si128(p1, p2), _mm_set1_epi32(-1));
+            __m128i mobility = _mm_sub_epi32(mobility4(p1, dames, empty, 0), mobility4(p2, dames, empty, 1));
+            __m128i score = _mm_sub_epi32(score1, score2);
+            for (int w = 0; w < Evaluation::MOBILITY_WEIGHT; ++w) score = _mm_add_epi32(score, mobility);
+
+            // Negate the lanes where player2 is to move
+            int sides;
+            __builtin_memcpy(&sides, &batch.sideToMove[i], sizeof(sides));
+            __m128i side = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(sides), _mm_setzero_si128()),
+                                              _mm_setzero_si128());
+            __m128i negate = _mm_sub_epi32(_mm_setzero_si128(), side);
+            score = _mm_sub_epi32(_mm_xor_si128(score, negate), negate);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&scores[i]), score);
+        }
+        return count;
+    }
+
+    // ---- AVX2: eight positions per step ----
+
+    __attribute__((target("avx2"))) inline __m256i shift8(__m256i mask, int direction) {
+        const __m256i even = _mm256_set1_epi32(static_cast<int>(BitMasks::EVEN_ROWS));
+        const __m256i odd = _mm256_set1_epi32(static_cast<int>(BitMasks::ODD_ROWS));
+        const __m256i notLeft = _mm256_set1_epi32(static_cast<int>(~BitMasks::LEFT_EDGE));
+        const __m256i notRight = _mm256_set1_epi32(static_cast<int>(~BitMasks::RIGHT_EDGE));
+        __m256i evenPart = _mm256_and_si256(mask, even);
+        __m256i oddPart = _mm256_and_si256(mask, odd);
+        switch (direction) {
+            case DOWN_RIGHT:
+                return _mm256_or_si256(_mm256_slli_epi32(evenPart, 4), _mm256_slli_epi32(_mm256_and_si256(oddPart, notRight), 5));
+            case DOWN_LEFT:
+                return _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(evenPart, notLeft), 3), _mm256_slli_epi32(oddPart, 4));
+            case UP_RIGHT:
+                return _mm256_or_si256(_mm256_srli_epi32(evenPart, 4), _mm256_srli_epi32(_mm256_and_si256(oddPart, notRight), 3));
+            default:
+                return _mm256_or_si256(_mm256_srli_epi32(_mm256_and_si256(evenPart, notLeft), 5), _mm256_srli_epi32(oddPart, 4));
+        }
+    }
+
+    __attribute__((target("avx2"))) inline __m256i popCount8(__m256i x) {
+        // Nibble lookup: count each half byte, then sum the four bytes of a lane
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0F);
+        __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, _mm256_and_si256(x, low)),
+                                         _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi32(x, 4), low)));
+        return _mm256_madd_epi16(_mm256_maddubs_epi16(counts, _mm256_set1_epi8(1)), _mm256_set1_epi16(1));
+    }
+
+    __attribute__((target("avx2"))) inline __m256i mobility8(__m256i own, __m256i dames, __m256i empty, int side) {
+        __m256i pions = _mm256_andnot_si256(dames, own);
+        __m256i ownDames = _mm256_and_si256(dames, own);
+        __m256i steps = _mm256_setzero_si256();
+        for (int dir : PION_DIRECTIONS[side]) {
+            steps = _mm256_add_epi32(steps, popCount8(_mm256_and_si256(shift8(pions, dir), empty)));
+        }
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            steps = _mm256_add_epi32(steps, popCount8(_mm256_and_si256(shift8(ownDames, dir), empty)));
+        }
+        return steps;
+    }
+
+    __attribute__((target("avx2")))
+    size_t evaluateAvx2(const PositionBatch& batch, int32_t* scores) {
+        const auto& table = PIECE_SQUARE_TABLES.value;
+        size_t count = batch.size() & ~static_cast<size_t>(7);
+
+        for (size_t i = 0; i < count; i += 8) {
+            __m256i p1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&batch.player1[i]));
+            __m256i p2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&batch.player2[i]));
+            __m256i dames = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&batch.dames[i]));
+
+            __m256i score1 = _mm256_setzero_si256();
+            __m256i score2 = _mm256_setzero_si256();
+            for (int square = 0; square < NUM_SQUARES; ++square) {
+                __m256i bit = _mm256_set1_epi32(static_cast<int>(1u << square));
+                __m256i isDame = _mm256_cmpeq_epi32(_mm256_and_si256(dames, bit), bit);
+                __m256i own1 = _mm256_cmpeq_epi32(_mm256_and_si256(p1, bit), bit);
+                __m256i own2 = _mm256_cmpeq_epi32(_mm256_and_si256(p2, bit), bit);
+
+                __m256i value1 = _mm256_blendv_epi8(_mm256_set1_epi32(table[0][PION][square]),
+                                                    _mm256_set1_epi32(table[0][DAME][square]), isDame);
+                __m256i value2 = _mm256_blendv_epi8(_mm256_set1_epi32(table[1][PION][square]),
+                                                    _mm256_set1_epi32(table[1][DAME][square]), isDame);
+                score1 = _mm256_add_epi32(score1, _mm256_and_si256(own1, value1));
+                score2 = _mm256_add_epi32(score2, _mm256_and_si256(own2, value2));
+            }
+
+            __m256i empty = _mm256_xor_si256(_mm256_or_si256(p1, p2), _mm256_set1_epi32(-1));
+            __m256i mobility = _mm256_sub_epi32(mobility8(p1, dames, empty, 0), mobility8(p2, dames, empty, 1));
+            __m256i score = _mm256_add_epi32(_mm256_sub_epi32(score1, score2),
+                                             _mm256_mullo_epi32(mobility, _mm256_set1_epi32(Evaluation::MOBILITY_WEIGHT)));
+
+            // Negate the lanes where player2 is to move
+            __m256i side = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&batch.sideToMove[i])));
+            __m256i negate = _mm256_sub_epi32(_mm256_setzero_si256(), side);
+            score = _mm256_sub_epi32(_mm256_xor_si256(score, negate), negate);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&scores[i]), score);
+        }
+        return count;
+    }
+#endif
+}
+
+BatchEvaluation::Kernel BatchEvaluation::bestKernel() {
+    static const Kernel best = isSupported(Kernel::AVX2) ? Kernel::AVX2
+                             : isSupported(Kernel::SSE2) ? Kernel::SSE2
+                             : Kernel::Scalar;
+    return best;
+}
+
+bool BatchEvaluation::isSupported(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::Scalar:
+            return true;
+#ifdef THAI_CHECKERS_X86_KERNELS
+        case Kernel::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case Kernel::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* BatchEvaluation::kernelName(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::SSE2: return "sse2";
+        case Kernel::AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+void BatchEvaluation::evaluate(const PositionBatch& batch, int32_t* scores) {
+    evaluate(batch, scores, bestKernel());
+}
+
+void BatchEvaluation::evaluate(const PositionBatch& batch, int32_t* scores, Kernel kernel) {
+    if (!isSupported(kernel)) kernel = Kernel::Scalar;
+
+    size_t done = 0;
+#ifdef THAI_CHECKERS_X86_KERNELS
+    if (kernel == Kernel::AVX2) done = evaluateAvx2(batch, scores);
+    if (kernel == Kernel::SSE2) done = evaluateSse2(batch, scores);
+#endif
+    evaluateScalar(batch, done, batch.size(), scores);
+}
+
+std::vector<int32_t> BatchEvaluation::evaluate(const PositionBatch& batch) {
+    std::vector<int32_t> scores(batch.size());
+    evaluate(batch, scores.data());
+    return scores;
+}
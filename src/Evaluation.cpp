@@ -0,0 +1,28 @@
+#include "Evaluation.h"
+#include "MoveTables.h"
+
+int Evaluation::evaluate(const GameModel& model) {
+    int side = model.getCurrentSide();
+    if (side == NO_SIDE) return 0;
+    int other = 1 - side;
+
+    const BitBoard& board = model.getBitBoard();
+    int score = model.getPieceSquareScore(side) - model.getPieceSquareScore(other);
+    score += MOBILITY_WEIGHT * (mobility(board, side) - mobility(board, other));
+    return score;
+}
+
+int Evaluation::mobility(const BitBoard& board, int side) {
+    uint32_t empty = board.empty();
+    uint32_t pions = board.pions(side);
+    uint32_t dames = board.damesOf(side);
+
+    int steps = 0;
+    for (int dir : PION_DIRECTIONS[side]) {
+        steps += popCount(shiftSquares(pions, dir) & empty);
+    }
+    for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+        steps += popCount(shiftSquares(dames, dir) & empty);
+    }
+    return steps;
+}
@@ -1,30 +1,37 @@
 #include "GameModel.h"
+#include "MoveTables.h"
+#include "PieceSquareTables.h"
+#include "Zobrist.h"
 #include <algorithm>
 #include <set>
 
 namespace {
     constexpr int BOARD_SIZE = 8;
-    
-    const std::vector<std::pair<int, int>> DIAGONAL_DIRECTIONS = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
 }
 
-GameModel::GameModel() : currentPlayer(""), player1Name(""), player2Name("") {
-    grid.resize(BOARD_SIZE, std::vector<Piece*>(BOARD_SIZE, nullptr));
-}
+GameModel::GameModel() : hash(0), pieceSquare{0, 0}, currentSide(NO_SIDE), currentPlayer(""), player1Name(""), player2Name(""), moveObserver(nullptr) {}
 
-GameModel::~GameModel() {
-    clearGrid();
-}
+GameModel::GameModel(const GameModel& other)
+    : bitboard(other.bitboard), hash(other.hash), pieceSquare{other.pieceSquare[0], other.pieceSquare[1]},
+      currentSide(other.currentSide), currentPlayer(other.currentPlayer), moveHistory(other.moveHistory),
+      player1Name(other.player1Name), player2Name(other.player2Name), moveObserver(nullptr) {}
 
-void GameModel::clearGrid() {
-    for (auto& row : grid) {
-        for (auto& piece : row) {
-            delete piece;
-            piece = nullptr;
-        }
-    }
+GameModel& GameModel::operator=(const GameModel& other) {
+    bitboard = other.bitboard;
+    hash = other.hash;
+    pieceSquare[0] = other.pieceSquare[0];
+    pieceSquare[1] = other.pieceSquare[1];
+    currentSide = other.currentSide;
+    currentPlayer = other.currentPlayer;
+    moveHistory = other.moveHistory;
+    player1Name = other.player1Name;
+    player2Name = other.player2Name;
+    moveObserver = nullptr;
+    return *this;
 }
 
+GameModel::~GameModel() = default;
+
 bool GameModel::isValidPosition(const Position& pos) const {
     return pos.x >= 0 && pos.x < BOARD_SIZE && pos.y >= 0 && pos.y < BOARD_SIZE;
 }
@@ -41,44 +48,49 @@ std::string GameModel::getOpponent(const std::string& player) const {
     return isPlayer1(player) ? player2Name : player1Name;
 }
 
+int GameModel::sideOf(const std::string& player) const {
+    if (isPlayer1(player)) return 0;
+    if (isPlayer2(player)) return 1;
+    return NO_SIDE;
+}
+
+const std::string& GameModel::playerName(int side) const {
+    return side == 0 ? player1Name : player2Name;
+}
+
 void GameModel::initializeStandardGame(const std::string& player1, const std::string& player2) {
     player1Name = player1;
     player2Name = player2;
-    clearGrid();
+    bitboard = BitBoard{};
     
-    // Place player1 pieces (top of board)
-    for (int row = 0; row < 2; ++row) {
-        for (int col = (row % 2); col < BOARD_SIZE; col += 2) {
-            grid[row][col] = new Piece(player1, {row, col});
-        }
-    }
+    // Place player1 pieces (top of board, rows 0-1)
+    bitboard.pieces[0] = 0x000000FFu;
     
-    // Place player2 pieces (bottom of board)
-    for (int row = 6; row < BOARD_SIZE; ++row) {
-        for (int col = (row % 2); col < BOARD_SIZE; col += 2) {
-            grid[row][col] = new Piece(player2, {row, col});
-        }
-    }
+    // Place player2 pieces (bottom of board, rows 6-7)
+    bitboard.pieces[1] = 0xFF000000u;
     
     currentPlayer = player1;
+    currentSide = 0;
+    hash = zobristHash(bitboard, currentSide);
+    updatePieceSquareScores();
 }
 
 void GameModel::setCurrentPlayer(const std::string& player) {
+    int side = sideOf(player);
+    if ((side == 1) != (currentSide == 1)) hash ^= ZOBRIST_KEYS.sideToMove;
     currentPlayer = player;
+    currentSide = side;
 }
 
 void GameModel::initializeFromGrid(const std::vector<std::vector<Piece*>>& initialGrid) {
-    clearGrid();
+    bitboard = BitBoard{};
     
     // Collect unique player names from the grid
     std::set<std::string> uniquePlayers;
-    
-    // Copy the grid and collect players
     for (int i = 0; i < BOARD_SIZE; ++i) {
         for (int j = 0; j < BOARD_SIZE; ++j) {
             if (initialGrid[i][j]) {
-                grid[i][j] = new Piece(*initialGrid[i][j]);
-                uniquePlayers.insert(grid[i][j]->getColor());
+                uniquePlayers.insert(initialGrid[i][j]->getColor());
             }
         }
     }
@@ -110,41 +122,278 @@ void GameModel::initializeFromGrid(const std::vector<std::vector<Piece*>>& initi
         }
     }
     
+    // Copy the pieces into the bitboard. Only dark squares are playable;
+    // pieces on light squares can never interact with the game and are dropped.
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        for (int j = 0; j < BOARD_SIZE; ++j) {
+            const Piece* piece = initialGrid[i][j];
+            if (!piece || !isPlayableSquare({i, j})) continue;
+            
+            uint32_t bit = 1u << squareIndex({i, j});
+            bitboard.pieces[isPlayer1(piece->getColor()) ? 0 : 1] |= bit;
+            if (piece->isDame()) bitboard.dames |= bit;
+        }
+    }
+    
     // Set current player to player1Name, or first player found
     currentPlayer = !player1Name.empty() ? player1Name : "DefaultPlayer";
+    currentSide = sideOf(currentPlayer);
+    hash = zobristHash(bitboard, currentSide);
+    updatePieceSquareScores();
+}
+
+void GameModel::initializeFromBitBoard(const std::string& player1, const std::string& player2,
+                                       const BitBoard& board, int sideToMove) {
+    player1Name = player1;
+    player2Name = player2;
+    bitboard = board;
+    
+    // Keep the masks consistent: no square on both sides, Dames only on pieces
+    bitboard.pieces[1] &= ~bitboard.pieces[0];
+    bitboard.dames &= bitboard.occupied();
+    
+    currentSide = sideToMove == 1 ? 1 : 0;
+    currentPlayer = playerName(currentSide);
+    hash = zobristHash(bitboard, currentSide);
+    updatePieceSquareScores();
+}
+
+void GameModel::writeNotation(char* out) const {
+    out[0] = currentSide == 1 ? '2' : '1';
+    out[1] = ':';
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        uint32_t bit = 1u << square;
+        char c = '.';
+        if (bitboard.pieces[0] & bit) c = 'x';
+        else if (bitboard.pieces[1] & bit) c = 'o';
+        if (bitboard.dames & bit) c = static_cast<char>(c - ('a' - 'A'));
+        out[2 + square] = c;
+    }
+}
+
+std::string GameModel::toNotation() const {
+    std::string notation(NOTATION_LENGTH, '.');
+    writeNotation(&notation[0]);
+    return notation;
+}
+
+bool GameModel::fromNotation(const std::string& notation) {
+    return fromNotation(notation.data(), notation.size());
+}
+
+bool GameModel::fromNotation(const char* text, size_t length) {
+    if (length != NOTATION_LENGTH || (text[0] != '1' && text[0] != '2') || text[1] != ':') return false;
+    
+    BitBoard board;
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        uint32_t bit = 1u << square;
+        switch (text[2 + square]) {
+            case '.': break;
+            case 'X': board.dames |= bit; // fall through
+            case 'x': board.pieces[0] |= bit; break;
+            case 'O': board.dames |= bit; // fall through
+            case 'o': board.pieces[1] |= bit; break;
+            default: return false;
+        }
+    }
+    
+    if (player1Name.empty()) player1Name = "Player1";
+    if (player2Name.empty()) player2Name = "Player2";
+    bitboard = board;
+    moveHistory.clear();
+    currentSide = text[0] == '2' ? 1 : 0;
+    currentPlayer = playerName(currentSide);
+    hash = zobristHash(bitboard, currentSide);
+    updatePieceSquareScores();
+    return true;
+}
+
+BoardView::BoardView(const BoardView& other) : pieces(other.pieces) {
+    link();
+}
+
+BoardView& BoardView::operator=(const BoardView& other) {
+    if (this != &other) {
+        pieces = other.pieces;
+        link();
+    }
+    return *this;
+}
+
+void BoardView::link() {
+    grid.assign(BOARD_SIZE, std::vector<Piece*>(BOARD_SIZE, nullptr));
+    for (auto& piece : pieces) {
+        Position pos = piece.getPosition();
+        grid[pos.x][pos.y] = &piece;
+    }
+}
+
+BoardView GameModel::getBoard() const {
+    BoardView view;
+    view.pieces.reserve(popCount(bitboard.occupied()));
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        for (uint32_t mask = bitboard.pieces[side]; mask; ) {
+            int square = popLowestSquare(mask);
+            Piece::Type type = (bitboard.dames >> square) & 1u ? Piece::Type::Dame : Piece::Type::Pion;
+            view.pieces.emplace_back(playerName(side), squarePosition(square), type);
+        }
+    }
+    view.link();
+    return view;
 }
 
 bool GameModel::canAnyPieceCapture() const {
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (grid[i][j] && grid[i][j]->getColor() == currentPlayer) {
-                std::vector<Move> captures = grid[i][j]->isDame() 
-                    ? generateDameCaptureMoves({i, j})
-                    : generatePionCaptureMoves({i, j});
-                if (!captures.empty()) return true;
-            }
+    if (currentSide == NO_SIDE) return false;
+    
+    // A capture sequence exists exactly when some piece has a first jump
+    uint32_t enemies = bitboard.pieces[1 - currentSide];
+    uint32_t empty = bitboard.empty();
+    
+    for (uint32_t mask = bitboard.pions(currentSide); mask; ) {
+        int square = popLowestSquare(mask);
+        for (int i = 0; i < 2; ++i) {
+            if ((MOVE_TABLES.pionStep[currentSide][square][i] & enemies) &&
+                (MOVE_TABLES.pionJump[currentSide][square][i] & empty)) return true;
+        }
+    }
+    
+    for (uint32_t mask = bitboard.damesOf(currentSide); mask; ) {
+        int square = popLowestSquare(mask);
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            const uint32_t* ray = MOVE_TABLES.ray[square][dir];
+            while (*ray & empty) ++ray;
+            if ((*ray & enemies) && (ray[1] & empty)) return true;
         }
     }
+    
     return false;
 }
 
-std::vector<Move> GameModel::getValidMoves(const Position& piecePos) const {
-    if (!isValidPosition(piecePos)) return {};
+bool GameModel::hasQuietMove() const {
+    if (currentSide == NO_SIDE) return false;
+    
+    // Any own piece with an empty neighbour in one of its step directions
+    uint32_t empty = bitboard.empty();
+    uint32_t pions = bitboard.pions(currentSide);
+    uint32_t dames = bitboard.damesOf(currentSide);
+    
+    for (int dir : PION_DIRECTIONS[currentSide]) {
+        if (shiftSquares(pions, dir) & empty) return true;
+    }
+    for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+        if (shiftSquares(dames, dir) & empty) return true;
+    }
+    return false;
+}
+
+void GameModel::generateCaptures(MoveList& moves) const {
+    moves.clear();
+    if (!canAnyPieceCapture()) return;
+    
+    for (uint32_t mask = bitboard.pieces[currentSide]; mask; ) {
+        int square = popLowestSquare(mask);
+        if ((bitboard.dames >> square) & 1u) {
+            generateDameCaptureMoves(square, moves);
+        } else {
+            generatePionCaptureMoves(square, moves);
+        }
+    }
+}
+
+void GameModel::generateMoves(MoveList& moves) const {
+    // Mandatory capture rule: if any piece can capture, only captures are legal
+    generateCaptures(moves);
+    if (!moves.empty() || currentSide == NO_SIDE) return;
+    
+    uint32_t ownPieces = bitboard.pieces[currentSide];
+    for (uint32_t mask = ownPieces; mask; ) {
+        int square = popLowestSquare(mask);
+        if ((bitboard.dames >> square) & 1u) {
+            generateDameSimpleMoves(square, moves);
+        } else {
+            generatePionSimpleMoves(square, moves);
+        }
+    }
+}
+
+Move GameModel::toMove(const MoveList::Entry& entry) const {
+    Move move;
+    move.from = squarePosition(entry.from);
+    move.path.reserve(entry.length);
+    for (int i = 0; i < entry.length; ++i) {
+        move.path.push_back(squarePosition(entry.path[i]));
+    }
+    move.captured.reserve(entry.captures);
+    for (int i = 0; i < entry.captures; ++i) {
+        move.captured.push_back(squarePosition(entry.captured[i]));
+    }
+    move.player = playerName(bitboard.sideAt(entry.from));
+    return move;
+}
+
+bool GameModel::promotesOn(int from, int to) const {
+    int side = bitboard.sideAt(from);
+    if (side == NO_SIDE || ((bitboard.dames >> from) & 1u)) return false;
+    return ((1u << to) & promotionRow(side)) != 0;
+}
+
+CompactMove GameModel::encodeMove(const MoveList::Entry& entry) const {
+    return CompactMove::make(entry.from, entry.to(), entry.capturedMask, promotesOn(entry.from, entry.to()));
+}
+
+CompactMove GameModel::encodeMove(const Move& move) const {
+    if (!isPlayableSquare(move.from) || move.path.empty()) return CompactMove();
+    
+    int from = squareIndex(move.from);
+    int to = squareIndex(move.path.back());
+    uint32_t capturedMask = 0;
+    for (const auto& capturedPos : move.captured) {
+        capturedMask |= 1u << squareIndex(capturedPos);
+    }
+    return CompactMove::make(from, to, capturedMask, promotesOn(from, to));
+}
+
+Move GameModel::decodeMove(CompactMove move) const {
+    int from = move.from();
+    int side = bitboard.sideAt(from);
+    if (move.isNull() || side == NO_SIDE) return Move{};
     
-    Piece* piece = grid[piecePos.x][piecePos.y];
-    if (!piece || piece->getColor() != currentPlayer) return {};
+    if (!move.isCapture()) {
+        return Move{squarePosition(from), {squarePosition(move.to())}, {}, playerName(side)};
+    }
+    
+    // Recover the landing squares by regenerating this piece's captures.
+    // Sequences with the same destination and capture set reach the same
+    // position, so the first one generated stands for all of them.
+    MoveList captures;
+    if ((bitboard.dames >> from) & 1u) {
+        generateDameCaptureMoves(from, captures);
+    } else {
+        generatePionCaptureMoves(from, captures);
+    }
     
-    // Mandatory capture rule: if any piece can capture, only return captures
-    if (canAnyPieceCapture()) {
-        return piece->isDame() 
-            ? generateDameCaptureMoves(piecePos)
-            : generatePionCaptureMoves(piecePos);
+    uint32_t capturedMask = move.capturedMask();
+    for (const auto& entry : captures) {
+        if (entry.to() == move.to() && entry.capturedMask == capturedMask) return toMove(entry);
     }
+    return Move{};
+}
+
+std::vector<Move> GameModel::getValidMoves(const Position& piecePos) const {
+    if (!isValidPosition(piecePos) || !isPlayableSquare(piecePos)) return {};
+    
+    int square = squareIndex(piecePos);
+    if (currentSide == NO_SIDE || bitboard.sideAt(square) != currentSide) return {};
+    
+    // generateMoves applies the mandatory capture rule across all pieces
+    MoveList moves;
+    generateMoves(moves);
     
-    // No captures available, return simple moves
-    return piece->isDame()
-        ? generateDameSimpleMoves(piecePos)
-        : generatePionSimpleMoves(piecePos);
+    std::vector<Move> pieceMoves;
+    for (const auto& entry : moves) {
+        if (entry.from == square) pieceMoves.push_back(toMove(entry));
+    }
+    return pieceMoves;
 }
 
 bool GameModel::isValidPionMove(const Position& from, const Position& to, const Piece* piece) const {
@@ -159,252 +408,279 @@ bool GameModel::isValidPionMove(const Position& from, const Position& to, const
     return (deltaX == forwardDirection) && (deltaY == 1);
 }
 
-std::vector<Move> GameModel::generatePionSimpleMoves(const Position& from) const {
-    std::vector<Move> moves;
-    Piece* piece = grid[from.x][from.y];
-    if (!piece || piece->isDame()) return moves;
-    
-    int forwardDirection = isPlayer1(piece->getColor()) ? 1 : -1;
-    
-    for (int dy : {-1, 1}) {
-        Position dest{from.x + forwardDirection, from.y + dy};
-        if (isValidPosition(dest) && !grid[dest.x][dest.y]) {
-            Move move{from, {dest}, {}, piece->getColor()};
-            moves.push_back(move);
-        }
+void GameModel::generatePionSimpleMoves(int from, MoveList& moves) const {
+    int side = bitboard.sideAt(from);
+    if (side == NO_SIDE || ((bitboard.dames >> from) & 1u)) return;
+    
+    uint32_t empty = bitboard.empty();
+    for (int i = 0; i < 2; ++i) {
+        uint32_t dest = MOVE_TABLES.pionStep[side][from][i] & empty;
+        if (dest) moves.addSimple(from, lowestSquare(dest));
     }
-    
-    return moves;
 }
 
-std::vector<Move> GameModel::generateDameSimpleMoves(const Position& from) const {
-    std::vector<Move> moves;
-    Piece* piece = grid[from.x][from.y];
-    if (!piece || !piece->isDame()) return moves;
-    
-    for (const auto& [dx, dy] : DIAGONAL_DIRECTIONS) {
-        for (int dist = 1; dist < BOARD_SIZE; ++dist) {
-            Position dest{from.x + dist * dx, from.y + dist * dy};
-            
-            if (!isValidPosition(dest) || grid[dest.x][dest.y]) break;
-            
-            Move move{from, {dest}, {}, piece->getColor()};
-            moves.push_back(move);
+void GameModel::generateDameSimpleMoves(int from, MoveList& moves) const {
+    int side = bitboard.sideAt(from);
+    if (side == NO_SIDE || !((bitboard.dames >> from) & 1u)) return;
+    
+    uint32_t empty = bitboard.empty();
+    for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+        for (const uint32_t* dest = MOVE_TABLES.ray[from][dir]; *dest & empty; ++dest) {
+            moves.addSimple(from, lowestSquare(*dest));
         }
     }
-    
-    return moves;
 }
 
-std::vector<Move> GameModel::generatePionCaptureMoves(const Position& from) const {
-    std::vector<Move> moves;
-    std::vector<Position> path, captured;
-    generatePionCaptureSequences(from, from, path, captured, moves);
-    return moves;
+void GameModel::generatePionCaptureMoves(int from, MoveList& moves) const {
+    int side = bitboard.sideAt(from);
+    if (side == NO_SIDE || ((bitboard.dames >> from) & 1u)) return;
+    
+    MoveList::Entry sequence;
+    sequence.from = static_cast<uint8_t>(from);
+    sequence.length = 0;
+    sequence.captures = 0;
+    sequence.capturedMask = 0;
+    generatePionCaptureSequences(side, from, sequence, moves);
 }
 
-void GameModel::generatePionCaptureSequences(const Position& from, const Position& current,
-                                             std::vector<Position>& path,
-                                             std::vector<Position>& captured,
-                                             std::vector<Move>& allMoves) const {
-    Piece* piece = grid[from.x][from.y];
-    if (!piece) return;
-    
+void GameModel::generatePionCaptureSequences(int side, int current, MoveList::Entry& sequence,
+                                             MoveList& moves) const {
     bool foundCapture = false;
-    int forwardDirection = isPlayer1(piece->getColor()) ? 1 : -1;
-    
-    for (int dy : {-1, 1}) {
-        int dx = forwardDirection;
-        Position enemy{current.x + dx, current.y + dy};
-        Position landing{current.x + 2*dx, current.y + 2*dy};
-        
-        if (!isValidPosition(landing)) continue;
-        if (!grid[enemy.x][enemy.y] || grid[enemy.x][enemy.y]->getColor() == piece->getColor()) continue;
-        if (grid[landing.x][landing.y]) continue;
-        if (std::find(captured.begin(), captured.end(), enemy) != captured.end()) continue;
+    uint32_t enemies = bitboard.pieces[1 - side] & ~sequence.capturedMask;
+    uint32_t empty = bitboard.empty();
+    
+    for (int i = 0; i < 2; ++i) {
+        uint32_t enemy = MOVE_TABLES.pionStep[side][current][i] & enemies;
+        if (!enemy) continue;
+        uint32_t landing = MOVE_TABLES.pionJump[side][current][i] & empty;
+        if (!landing) continue;
         
         foundCapture = true;
+        int landingSquare = lowestSquare(landing);
         
-        path.push_back(landing);
-        captured.push_back(enemy);
+        int depth = sequence.length;
+        sequence.path[depth] = static_cast<uint8_t>(landingSquare);
+        sequence.captured[depth] = static_cast<uint8_t>(lowestSquare(enemy));
+        sequence.length = sequence.captures = static_cast<uint8_t>(depth + 1);
+        sequence.capturedMask |= enemy;
         
-        generatePionCaptureSequences(from, landing, path, captured, allMoves);
+        generatePionCaptureSequences(side, landingSquare, sequence, moves);
         
-        path.pop_back();
-        captured.pop_back();
+        sequence.length = sequence.captures = static_cast<uint8_t>(depth);
+        sequence.capturedMask &= ~enemy;
     }
     
-    if (!foundCapture && !captured.empty()) {
-        Move move{from, path, captured, piece->getColor()};
-        allMoves.push_back(move);
+    if (!foundCapture && sequence.captures) {
+        moves.add(sequence);
     }
 }
 
-std::vector<Move> GameModel::generateDameCaptureMoves(const Position& from) const {
-    std::vector<Move> allMoves;
-    std::vector<Position> path;
-    std::vector<Position> captured;
-    
-    generateDameCaptureSequences(from, from, path, captured, allMoves, 0, 0);
-    
-    return allMoves;
+void GameModel::generateDameCaptureMoves(int from, MoveList& moves) const {
+    int side = bitboard.sideAt(from);
+    if (side == NO_SIDE || !((bitboard.dames >> from) & 1u)) return;
+    
+    MoveList::Entry sequence;
+    sequence.from = static_cast<uint8_t>(from);
+    sequence.length = 0;
+    sequence.captures = 0;
+    sequence.capturedMask = 0;
+    generateDameCaptureSequences(side, from, sequence, moves);
 }
 
-void GameModel::generateDameCaptureSequences(const Position& from, const Position& current,
-                                             std::vector<Position>& path,
-                                             std::vector<Position>& captured,
-                                             std::vector<Move>& allMoves, int dx, int dy) const {
-    Piece* piece = grid[from.x][from.y];
-    if (!piece || !piece->isDame()) return;
-    
+void GameModel::generateDameCaptureSequences(int side, int current, MoveList::Entry& sequence,
+                                             MoveList& moves) const {
     bool foundCapture = false;
-    
-    for (const auto& [dx, dy] : DIAGONAL_DIRECTIONS) {
-        for (int dist = 1; dist < BOARD_SIZE; ++dist) {
-            Position checkPos{current.x + dist * dx, current.y + dist * dy};
-            
-            if (!isValidPosition(checkPos)) break;
-            
-            // Found enemy piece
-            if (grid[checkPos.x][checkPos.y] && grid[checkPos.x][checkPos.y]->getColor() != piece->getColor()) {
-                if (std::find(captured.begin(), captured.end(), checkPos) != captured.end()) break;
-                
-                Position landing{current.x + (dist + 1) * dx, current.y + (dist + 1) * dy};
-                
-                if (!isValidPosition(landing)) break;
-                
-                if (!grid[landing.x][landing.y]) {
-                    foundCapture = true;
-                    
-                    path.push_back(landing);
-                    captured.push_back(checkPos);
-                    
-                    generateDameCaptureSequences(from, landing, path, captured, allMoves, 0, 0);
-                    
-                    path.pop_back();
-                    captured.pop_back();
-                }
-                break;
-            }
-            
-            if (grid[checkPos.x][checkPos.y]) break;
-        }
+    // Captured pieces stay on the board until the move is executed, so they
+    // still block rays but can't be jumped twice. The Dame's own starting
+    // square also stays occupied.
+    uint32_t enemies = bitboard.pieces[1 - side] & ~sequence.capturedMask;
+    uint32_t empty = bitboard.empty();
+    
+    for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+        // Slide over empty squares to the first occupied one (or the
+        // zero terminator past the board edge)
+        const uint32_t* ray = MOVE_TABLES.ray[current][dir];
+        while (*ray & empty) ++ray;
+        
+        uint32_t target = *ray;
+        if (!(target & enemies)) continue;
+        
+        // Must land on the square immediately beyond the enemy piece
+        uint32_t landing = ray[1] & empty;
+        if (!landing) continue;
+        
+        foundCapture = true;
+        int landingSquare = lowestSquare(landing);
+        
+        int depth = sequence.length;
+        sequence.path[depth] = static_cast<uint8_t>(landingSquare);
+        sequence.captured[depth] = static_cast<uint8_t>(lowestSquare(target));
+        sequence.length = sequence.captures = static_cast<uint8_t>(depth + 1);
+        sequence.capturedMask |= target;
+        
+        generateDameCaptureSequences(side, landingSquare, sequence, moves);
+        
+        sequence.length = sequence.captures = static_cast<uint8_t>(depth);
+        sequence.capturedMask &= ~target;
     }
     
-    if (!foundCapture && !captured.empty()) {
-        Move move{from, path, captured, piece->getColor()};
-        allMoves.push_back(move);
+    if (!foundCapture && sequence.captures) {
+        moves.add(sequence);
     }
 }
 
 std::map<Position, std::vector<Move>> GameModel::getAllValidMoves() const {
     std::map<Position, std::vector<Move>> allMoves;
     
-    // Check if any piece can capture
-    bool hasCaptures = false;
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (grid[i][j] && grid[i][j]->getColor() == currentPlayer) {
-                Position pos{i, j};
-                std::vector<Move> captures = grid[i][j]->isDame() 
-                    ? generateDameCaptureMoves(pos)
-                    : generatePionCaptureMoves(pos);
-                
-                if (!captures.empty()) {
-                    hasCaptures = true;
-                    allMoves[pos] = captures;
-                }
-            }
-        }
-    }
-    
-    if (hasCaptures) return allMoves;
+    MoveList moves;
+    generateMoves(moves);
     
-    // No captures, return simple moves
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (grid[i][j] && grid[i][j]->getColor() == currentPlayer) {
-                Position pos{i, j};
-                std::vector<Move> moves = grid[i][j]->isDame() 
-                    ? generateDameSimpleMoves(pos)
-                    : generatePionSimpleMoves(pos);
-                
-                if (!moves.empty()) {
-                    allMoves[pos] = moves;
-                }
-            }
+    // Entries are grouped by origin square in ascending order
+    auto hint = allMoves.end();
+    for (const auto& entry : moves) {
+        Position from = squarePosition(entry.from);
+        if (hint == allMoves.end() || !(hint->first == from)) {
+            hint = allMoves.emplace_hint(allMoves.end(), from, std::vector<Move>());
         }
+        hint->second.push_back(toMove(entry));
     }
     
     return allMoves;
 }
 
-void GameModel::executeMove(const Move& move) {
-    Piece* piece = grid[move.from.x][move.from.y];
-    if (!piece) return;
+GameModel::UndoInfo GameModel::applyMove(int from, int to, uint32_t capturedMask) {
+    UndoInfo undo{static_cast<uint8_t>(from), static_cast<uint8_t>(to), NO_SIDE,
+                  static_cast<int8_t>(currentSide), false, 0, 0, hash,
+                  {pieceSquare[0], pieceSquare[1]}};
+    int side = bitboard.sideAt(from);
+    if (side == NO_SIDE) return undo;
+    undo.side = static_cast<int8_t>(side);
     
     // Move piece to final position
-    Position finalPos = move.path.back();
-    grid[finalPos.x][finalPos.y] = piece;
-    grid[move.from.x][move.from.y] = nullptr;
-    piece->setPosition(finalPos);
-    
-    checkPromotion(finalPos);
+    uint32_t fromBit = 1u << from;
+    uint32_t toBit = 1u << to;
+    int kind = (bitboard.dames & fromBit) ? DAME_KIND : PION_KIND;
+    bitboard.pieces[side] ^= fromBit | toBit;
+    hash ^= ZOBRIST_KEYS.piece[side][kind][from] ^ ZOBRIST_KEYS.piece[side][kind][to];
+    pieceSquare[side] += PIECE_SQUARE_TABLES.value[side][kind][to] - PIECE_SQUARE_TABLES.value[side][kind][from];
+    if (kind == DAME_KIND) {
+        bitboard.dames ^= fromBit | toBit;
+    } else {
+        checkPromotion(to);
+        undo.promoted = (bitboard.dames & toBit) != 0;
+    }
     
     // Remove captured pieces
-    for (const auto& capturedPos : move.captured) {
-        delete grid[capturedPos.x][capturedPos.y];
-        grid[capturedPos.x][capturedPos.y] = nullptr;
+    int opponent = 1 - side;
+    undo.captured = capturedMask & bitboard.pieces[opponent];
+    undo.capturedDames = undo.captured & bitboard.dames;
+    for (uint32_t mask = undo.captured; mask; ) {
+        int square = popLowestSquare(mask);
+        int capturedKind = (undo.capturedDames >> square) & 1u;
+        hash ^= ZOBRIST_KEYS.piece[opponent][capturedKind][square];
+        pieceSquare[opponent] -= PIECE_SQUARE_TABLES.value[opponent][capturedKind][square];
+    }
+    bitboard.pieces[opponent] &= ~undo.captured;
+    bitboard.dames &= ~undo.captured;
+    
+    // Switch turns (an unknown current player hands the move to player1)
+    int nextSide = currentSide == 0 ? 1 : 0;
+    if ((nextSide == 1) != (currentSide == 1)) hash ^= ZOBRIST_KEYS.sideToMove;
+    currentSide = nextSide;
+    return undo;
+}
+
+GameModel::UndoInfo GameModel::makeMove(const Move& move) {
+    if (!isPlayableSquare(move.from) || move.path.empty()) {
+        return UndoInfo{0, 0, NO_SIDE, static_cast<int8_t>(currentSide), false, 0, 0, hash,
+                        {pieceSquare[0], pieceSquare[1]}};
     }
     
+    uint32_t capturedMask = 0;
+    for (const auto& capturedPos : move.captured) {
+        capturedMask |= 1u << squareIndex(capturedPos);
+    }
+    return applyMove(squareIndex(move.from), squareIndex(move.path.back()), capturedMask);
+}
+
+GameModel::UndoInfo GameModel::makeMove(const MoveList::Entry& entry) {
+    return applyMove(entry.from, entry.to(), entry.capturedMask);
+}
+
+GameModel::UndoInfo GameModel::makeMove(CompactMove move) {
+    return applyMove(move.from(), move.to(), move.capturedMask());
+}
+
+void GameModel::unmakeMove(const UndoInfo& undo) {
+    if (undo.side == NO_SIDE) return;
+    
+    currentSide = undo.previousSide;
+    hash = undo.previousHash;
+    pieceSquare[0] = undo.previousPieceSquare[0];
+    pieceSquare[1] = undo.previousPieceSquare[1];
+    
+    int side = undo.side;
+    uint32_t fromBit = 1u << undo.from;
+    uint32_t toBit = 1u << undo.to;
+    if (undo.promoted) bitboard.dames &= ~toBit;
+    bitboard.pieces[side] ^= fromBit | toBit;
+    if (bitboard.dames & toBit) bitboard.dames ^= fromBit | toBit;
+    
+    // Restore captured pieces
+    bitboard.pieces[1 - side] |= undo.captured;
+    bitboard.dames |= undo.capturedDames;
+}
+
+void GameModel::executeMove(const Move& move) {
+    // Encoding needs the position the move is played from
+    CompactMove compact = moveObserver ? encodeMove(move) : CompactMove();
+    if (makeMove(move).side == NO_SIDE) return;
     moveHistory.push_back(move);
-    
-    // Switch turns
-    currentPlayer = getOpponent(currentPlayer);
+    if (moveObserver) moveObserver->onMove(*this, compact);
 }
 
-void GameModel::checkPromotion(const Position& pos) {
-    Piece* piece = grid[pos.x][pos.y];
-    if (!piece || piece->isDame()) return;
-    
-    bool shouldPromote = isPlayer1(piece->getColor()) ? (pos.x == 7) : (pos.x == 0);
-    if (shouldPromote) piece->promote();
+void GameModel::checkPromotion(int square) {
+    int side = bitboard.sideAt(square);
+    if (side == NO_SIDE) return;
+    
+    uint32_t bit = 1u << square;
+    if ((bit & promotionRow(side)) && !(bitboard.dames & bit)) {
+        bitboard.dames |= bit;
+        hash ^= ZOBRIST_KEYS.piece[side][PION_KIND][square] ^ ZOBRIST_KEYS.piece[side][DAME_KIND][square];
+        pieceSquare[side] += PIECE_SQUARE_TABLES.value[side][DAME_KIND][square] -
+                             PIECE_SQUARE_TABLES.value[side][PION_KIND][square];
+    }
+}
+
+void GameModel::updatePieceSquareScores() {
+    pieceSquare[0] = pieceSquareScore(bitboard, 0);
+    pieceSquare[1] = pieceSquareScore(bitboard, 1);
+}
+
+bool GameModel::hasAnyLegalMove() const {
+    // A forced capture only narrows the legal moves, so either kind proves one exists
+    return hasQuietMove() || canAnyPieceCapture();
 }
 
 bool GameModel::isGameOver() const {
-    return getAllValidMoves().empty();
+    return !hasAnyLegalMove();
+}
+
+int GameModel::getWinnerSide() const {
+    if (hasAnyLegalMove()) return NO_SIDE;
+    return currentSide == 0 ? 1 : 0;
 }
 
 std::string GameModel::getWinner() const {
-    if (!isGameOver()) return "";
-    return getOpponent(currentPlayer);
+    int side = getWinnerSide();
+    return side == NO_SIDE ? "" : playerName(side);
 }
 
 int GameModel::getPieceCount(const std::string& player) const {
-    int count = 0;
-    for (const auto& row : grid) {
-        for (const auto& piece : row) {
-            if (piece && piece->getColor() == player) count++;
-        }
-    }
-    return count;
+    int side = sideOf(player);
+    return side == NO_SIDE ? 0 : popCount(bitboard.pieces[side]);
 }
 
 GameModel* GameModel::clone() const {
-    GameModel* copy = new GameModel();
-    copy->currentPlayer = currentPlayer;
-    copy->player1Name = player1Name;
-    copy->player2Name = player2Name;
-    copy->moveHistory = moveHistory;
-    
-    // Deep copy the grid
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (grid[i][j]) {
-                copy->grid[i][j] = new Piece(*grid[i][j]);
-            }
-        }
-    }
-    
-    return copy;
-}
\ No newline at end of file
+    return new GameModel(*this);
+}
@@ -0,0 +1,299 @@
+#include "GameRecordFile.h"
+#include "MoveList.h"
+#include <cstring>
+
+namespace {
+    constexpr size_t HEADER_SIZE = 8;
+
+    constexpr uint8_t MARKER_BIT = 0x80;
+    constexpr uint8_t START_BIT = 0x40;
+    constexpr uint8_t STANDARD_START = 0xC0;
+    constexpr uint8_t CUSTOM_START = 0xC1;      // + side to move
+    constexpr uint8_t END_OF_GAME = 0x80;       // + 1 + winner
+    constexpr uint8_t FLAG_BIT = 0x20;          // Capture follows / promotion
+    constexpr uint8_t SQUARE_BITS = 0x1F;
+
+    // CompactMove field layout, see CompactMove.h
+    constexpr int TO_SHIFT = 5;
+    constexpr int PROMOTION_SHIFT = 10;
+    constexpr int CAPTURE_SHIFT = 11;
+    constexpr uint32_t CAPTURE_LIMIT = 1u << NUM_INTERIOR_SQUARES;
+
+    const BitBoard& standardBoard() {
+        static const BitBoard board = []() {
+            GameModel model;
+            model.initializeStandardGame("Player1", "Player2");
+            return model.getBitBoard();
+        }();
+        return board;
+    }
+}
+
+void RecordedGame::setUp(GameModel& model) const {
+    if (standardStart) {
+        model.initializeStandardGame("Player1", "Player2");
+    } else {
+        model.initializeFromBitBoard("Player1", "Player2", start, sideToMove);
+    }
+}
+
+GameRecordWriter::~GameRecordWriter() {
+    close();
+}
+
+bool GameRecordWriter::open(const std::string& path) {
+    close();
+
+    // An existing file must already be a record file of this version
+    std::ifstream existing(path, std::ios::binary | std::ios::ate);
+    bool empty = true;
+    if (existing) {
+        std::streamoff size = existing.tellg();
+        if (size > 0) {
+            uint8_t header[HEADER_SIZE];
+            existing.seekg(0);
+            if (size < static_cast<std::streamoff>(HEADER_SIZE) ||
+                !existing.read(reinterpret_cast<char*>(header), HEADER_SIZE) ||
+                std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0 || (header[4] | (header[5] << 8)) != VERSION) {
+                return false;
+            }
+            empty = false;
+        }
+    }
+
+    file.open(path, std::ios::binary | std::ios::app);
+    if (!file) return false;
+    buffer.reserve(BUFFER_SIZE);
+    if (empty) {
+        for (char c : MAGIC) put(static_cast<uint8_t>(c));
+        put(VERSION & 0xFF);
+        put(VERSION >> 8);
+        put(0);
+        put(0);
+    }
+    return true;
+}
+
+void GameRecordWriter::close() {
+    if (!file.is_open()) return;
+    if (inGame) endGame(NO_SIDE);
+    flush();
+    file.close();
+}
+
+void GameRecordWriter::beginGame(const GameModel& model) {
+    if (inGame) endGame(NO_SIDE);
+    inGame = true;
+
+    const BitBoard& board = model.getBitBoard();
+    int side = model.getCurrentSide();
+    if (board == standardBoard() && side == 0) {
+        put(STANDARD_START);
+        return;
+    }
+
+    // A model with no side to move hands its first move to Player1
+    put(static_cast<uint8_t>(CUSTOM_START + (side == 1 ? 1 : 0)));
+    putMask(board.pieces[0]);
+    putMask(board.pieces[1]);
+    putMask(board.dames);
+}
+
+void GameRecordWriter::addMove(CompactMove move) {
+    uint32_t raw = move.raw();
+    uint32_t captures = raw >> CAPTURE_SHIFT;
+    put(static_cast<uint8_t>((raw & SQUARE_BITS) | (captures ? FLAG_BIT : 0)));
+    put(static_cast<uint8_t>(((raw >> TO_SHIFT) & SQUARE_BITS) | (move.isPromotion() ? FLAG_BIT : 0)));
+    if (captures) {
+        put(static_cast<uint8_t>(captures));
+        put(static_cast<uint8_t>(captures >> 8));
+        put(static_cast<uint8_t>(captures >> 16));
+    }
+    ++moves;
+}
+
+void GameRecordWriter::endGame(int winner) {
+    if (!inGame) return;
+    put(static_cast<uint8_t>(END_OF_GAME + (winner == NO_SIDE ? 0 : winner + 1)));
+    inGame = false;
+    ++games;
+}
+
+void GameRecordWriter::writeGame(const RecordedGame& game) {
+    GameModel start;
+    game.setUp(start);
+    beginGame(start);
+    for (const auto& move : game.moves) addMove(move);
+    endGame(game.winner);
+}
+
+void GameRecordWriter::attach(GameModel& model) {
+    beginGame(model);
+    model.setMoveObserver(this);
+}
+
+void GameRecordWriter::detach(GameModel& model, int winner) {
+    if (model.getMoveObserver() == this) model.setMoveObserver(nullptr);
+    endGame(winner);
+}
+
+void GameRecordWriter::onMove(const GameModel&, CompactMove move) {
+    if (inGame) addMove(move);
+}
+
+void GameRecordWriter::flush() {
+    if (buffer.empty() || !file.is_open()) return;
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    file.flush();
+    buffer.clear();
+}
+
+void GameRecordWriter::putMask(uint32_t mask) {
+    for (int shift = 0; shift < 32; shift += 8) put(static_cast<uint8_t>(mask >> shift));
+}
+
+bool GameRecordReader::open(const std::string& path) {
+    close();
+    file.open(path, std::ios::binary);
+    if (!file) return false;
+
+    buffer.resize(BUFFER_SIZE);
+    uint8_t header[HEADER_SIZE];
+    for (auto& byte : header) {
+        if (!get(byte)) {
+            close();
+            return false;
+        }
+    }
+    if (std::memcmp(header, GameRecordWriter::MAGIC, sizeof(GameRecordWriter::MAGIC)) != 0 ||
+        (header[4] | (header[5] << 8)) != GameRecordWriter::VERSION) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void GameRecordReader::close() {
+    if (file.is_open()) file.close();
+    file.clear();
+    position = filled = 0;
+    pendingMarker = -1;
+    corrupt = false;
+}
+
+bool GameRecordReader::refill() {
+    if (!file.is_open()) return false;
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    filled = static_cast<size_t>(file.gcount());
+    position = 0;
+    return filled > 0;
+}
+
+bool GameRecordReader::getMask(uint32_t& mask) {
+    mask = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint8_t byte;
+        if (!get(byte)) return false;
+        mask |= static_cast<uint32_t>(byte) << shift;
+    }
+    return true;
+}
+
+bool GameRecordReader::next(RecordedGame& game) {
+    if (corrupt) return false;
+
+    uint8_t byte;
+    if (pendingMarker >= 0) {
+        byte = static_cast<uint8_t>(pendingMarker);
+        pendingMarker = -1;
+    } else if (!get(byte)) {
+        return false;
+    }
+
+    // Start marker
+    if ((byte & (MARKER_BIT | START_BIT)) != (MARKER_BIT | START_BIT) || byte > CUSTOM_START + 1) {
+        corrupt = true;
+        return false;
+    }
+    game.moves.clear();
+    game.winner = NO_SIDE;
+    game.standardStart = byte == STANDARD_START;
+    game.start = BitBoard();
+    game.sideToMove = 0;
+    if (!game.standardStart) {
+        game.sideToMove = byte - CUSTOM_START;
+        if (!getMask(game.start.pieces[0]) || !getMask(game.start.pieces[1]) ||
+            !getMask(game.start.dames)) return false;
+        if ((game.start.pieces[0] & game.start.pieces[1]) || (game.start.dames & ~game.start.occupied())) {
+            corrupt = true;
+            return false;
+        }
+    }
+
+    // Moves up to the end marker
+    while (true) {
+        if (!get(byte)) return false;
+        if ((byte & (MARKER_BIT | START_BIT)) == (MARKER_BIT | START_BIT)) {
+            // The writer stopped mid-game and a new game was appended
+            pendingMarker = byte;
+            return true;
+        }
+        if (byte & MARKER_BIT) {
+            if (byte > END_OF_GAME + 2) {
+                corrupt = true;
+                return false;
+            }
+            game.winner = byte == END_OF_GAME ? NO_SIDE : byte - END_OF_GAME - 1;
+            return true;
+        }
+
+        uint8_t second;
+        if (!get(second)) return false;
+        if ((byte & ~(SQUARE_BITS | FLAG_BIT)) || (second & ~(SQUARE_BITS | FLAG_BIT))) {
+            corrupt = true;
+            return false;
+        }
+        uint32_t raw = (byte & SQUARE_BITS) | (static_cast<uint32_t>(second & SQUARE_BITS) << TO_SHIFT);
+        if (second & FLAG_BIT) raw |= 1u << PROMOTION_SHIFT;
+        if (byte & FLAG_BIT) {
+            uint32_t captures = 0;
+            for (int shift = 0; shift < 24; shift += 8) {
+                uint8_t part;
+                if (!get(part)) return false;
+                captures |= static_cast<uint32_t>(part) << shift;
+            }
+            if (captures == 0 || captures >= CAPTURE_LIMIT) {
+                corrupt = true;
+                return false;
+            }
+            raw |= captures << CAPTURE_SHIFT;
+        }
+        game.moves.push_back(CompactMove::fromRaw(raw));
+    }
+}
+
+bool GameRecordReader::replay(GameModel& model, int& winner) {
+    RecordedGame game;
+    if (!next(game)) return false;
+
+    // decodeMove trusts quiet moves, so match each against the generator
+    game.setUp(model);
+    MoveList legal;
+    for (const auto& compact : game.moves) {
+        model.generateMoves(legal);
+        const MoveList::Entry* played = nullptr;
+        for (const auto& entry : legal) {
+            if (model.encodeMove(entry) == compact) {
+                played = &entry;
+                break;
+            }
+        }
+        if (!played) {
+            corrupt = true;
+            return false;
+        }
+        model.executeMove(model.toMove(*played));
+    }
+    winner = game.winner;
+    return true;
+}
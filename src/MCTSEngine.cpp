@@ -0,0 +1,339 @@
+#include "MCTSEngine.h"
+#include "MoveList.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <utility>
+
+namespace {
+    constexpr uint32_t NO_NODE = std::numeric_limits<uint32_t>::max();
+
+    // Simulations between clock reads, per thread
+    constexpr uint64_t CLOCK_INTERVAL = 16;
+}
+
+MCTSEngine::MCTSEngine(size_t memoryMB, unsigned threadCount, uint64_t rngSeed) : seed(rngSeed) {
+    static_assert(sizeof(Node) == 24, "Node should stay 24 bytes");
+
+    // Half the budget per buffer
+    size_t perPool = (std::max<size_t>(memoryMB, 1) << 20) / (2 * sizeof(Node));
+    poolCapacity = std::min<size_t>(perPool, NO_NODE);
+    for (auto& pool : pools) pool.nodes.reset(new Node[poolCapacity]);
+    setThreads(threadCount);
+}
+
+MCTSEngine::~MCTSEngine() = default;
+
+void MCTSEngine::setThreads(unsigned threadCount) {
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+
+    workers.clear();
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+        workers.back()->id = static_cast<int>(i);
+        workers.back()->rng = Xoshiro256(seed + i * 0x9E3779B97F4A7C15ull);
+    }
+    threadPool.reset();
+    if (threadCount > 1) threadPool = std::make_unique<ThreadPool>(threadCount - 1);
+}
+
+void MCTSEngine::clear() {
+    hasTree = false;
+    pools[0].used.store(0, std::memory_order_relaxed);
+    pools[1].used.store(0, std::memory_order_relaxed);
+}
+
+size_t MCTSEngine::treeSize() const {
+    return hasTree ? pools[active].used.load(std::memory_order_relaxed) : 0;
+}
+
+MCTSResult MCTSEngine::search(const GameModel& model, const MCTSLimits& searchLimits) {
+    limits = searchLimits;
+    startTime = std::chrono::steady_clock::now();
+    stopSignal.store(false, std::memory_order_relaxed);
+    sharedSimulations.store(0, std::memory_order_relaxed);
+    nodeLimit = limits.maxNodes ? std::min(limits.maxNodes, poolCapacity) : poolCapacity;
+
+    MCTSResult result;
+    MoveList rootMoves;
+    model.generateMoves(rootMoves);
+    if (rootMoves.empty()) return result;
+
+    if (!reuseTree(model)) resetTree(model);
+    result.reusedVisits = node(0).visits.load(std::memory_order_relaxed);
+
+    Node& root = node(0);
+    if (root.state.load(std::memory_order_acquire) != EXPANDED && !expand(root, rootPosition)) {
+        // Not even the root's children fit in the budget
+        result.bestMove = model.toMove(rootMoves[0]);
+        return result;
+    }
+
+    for (auto& worker : workers) worker->simulations = 0;
+
+    ThreadPool::TaskGroup helpers;
+    for (size_t i = 1; i < workers.size(); ++i) {
+        Worker* helper = workers[i].get();
+        threadPool->submit(helpers, [this, helper]() { run(*helper); });
+    }
+    run(*workers[0]);
+    stopSignal.store(true, std::memory_order_relaxed);
+    if (threadPool) threadPool->wait(helpers);
+
+    // The most visited move is the most trusted one
+    uint32_t best = root.firstChild;
+    for (uint32_t child = root.firstChild; child < root.firstChild + root.childCount; ++child) {
+        uint32_t visits = node(child).visits.load(std::memory_order_relaxed);
+        uint32_t bestVisits = node(best).visits.load(std::memory_order_relaxed);
+        if (visits > bestVisits ||
+            (visits == bestVisits && node(child).score.load(std::memory_order_relaxed) >
+                                     node(best).score.load(std::memory_order_relaxed))) {
+            best = child;
+        }
+    }
+
+    const Node& chosen = node(best);
+    result.bestMove = rootPosition.decodeMove(chosen.move);
+    result.visits = chosen.visits.load(std::memory_order_relaxed);
+    if (result.visits > 0) result.winRate = chosen.score.load(std::memory_order_relaxed) / (2.0 * result.visits);
+    for (const auto& worker : workers) result.simulations += worker->simulations;
+    result.nodes = treeSize();
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+
+void MCTSEngine::run(Worker& worker) {
+    while (!shouldStop(worker)) simulate(worker);
+}
+
+bool MCTSEngine::shouldStop(const Worker& worker) {
+    if (stopSignal.load(std::memory_order_relaxed)) return true;
+
+    if (limits.maxTimeMs > 0 && worker.simulations % CLOCK_INTERVAL == 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        if (elapsed >= limits.maxTimeMs) {
+            stopSignal.store(true, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Each simulation reserves its slot, so the budget is met exactly
+    if (limits.maxSimulations > 0 &&
+        sharedSimulations.fetch_add(1, std::memory_order_relaxed) >= limits.maxSimulations) {
+        stopSignal.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void MCTSEngine::simulate(Worker& worker) {
+    GameModel& position = worker.position;
+    position = rootPosition;
+    worker.path.clear();
+    worker.movers.clear();
+
+    // Selection: descend by UCT, marking the line with virtual loss
+    uint32_t index = 0;
+    worker.path.push_back(0);
+    worker.movers.push_back(static_cast<int8_t>(1 - position.getCurrentSide()));
+    node(0).virtualLoss.fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+
+    while (true) {
+        Node& current = node(index);
+        uint8_t state = current.state.load(std::memory_order_acquire);
+        if (state != EXPANDED) {
+            // Leaves are expanded on their second visit, which keeps
+            // one-off lines out of the pool
+            if (state == UNEXPANDED && current.visits.load(std::memory_order_relaxed) > 0 &&
+                expand(current, position)) {
+                continue;
+            }
+            break;
+        }
+        if (current.childCount == 0) break;
+
+        uint32_t child = current.firstChild + select(current);
+        int side = position.getCurrentSide();
+        position.makeMove(node(child).move);
+        node(child).virtualLoss.fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+        worker.path.push_back(child);
+        worker.movers.push_back(static_cast<int8_t>(side));
+        index = child;
+    }
+
+    // A leaf with no legal move is lost for its side to move
+    const Node& leaf = node(index);
+    bool terminal = leaf.state.load(std::memory_order_acquire) == EXPANDED && leaf.childCount == 0;
+    int winner = terminal ? 1 - position.getCurrentSide() : playout(worker);
+
+    for (size_t k = 0; k < worker.path.size(); ++k) {
+        Node& visited = node(worker.path[k]);
+        uint32_t points = winner == worker.movers[k] ? 2 : winner == NO_SIDE ? 1 : 0;
+        visited.score.fetch_add(points, std::memory_order_relaxed);
+        visited.visits.fetch_add(1, std::memory_order_relaxed);
+        visited.virtualLoss.fetch_sub(VIRTUAL_LOSS, std::memory_order_relaxed);
+    }
+    ++worker.simulations;
+}
+
+uint32_t MCTSEngine::select(const Node& parent) const {
+    uint32_t parentVisits = parent.visits.load(std::memory_order_relaxed) +
+                            parent.virtualLoss.load(std::memory_order_relaxed);
+    double logVisits = std::log(static_cast<double>(std::max<uint32_t>(parentVisits, 1)));
+
+    uint32_t best = 0;
+    double bestValue = -1.0;
+    for (uint32_t k = 0; k < parent.childCount; ++k) {
+        const Node& child = node(parent.firstChild + k);
+        uint32_t visits = child.visits.load(std::memory_order_relaxed) +
+                          child.virtualLoss.load(std::memory_order_relaxed);
+        if (visits == 0) return k;
+
+        // Pending visits count in the denominator but score nothing
+        double mean = child.score.load(std::memory_order_relaxed) / (2.0 * visits);
+        double value = mean + EXPLORATION * std::sqrt(logVisits / visits);
+        if (value > bestValue) {
+            bestValue = value;
+            best = k;
+        }
+    }
+    return best;
+}
+
+bool MCTSEngine::expand(Node& target, const GameModel& position) {
+    uint8_t expected = UNEXPANDED;
+    if (!target.state.compare_exchange_strong(expected, EXPANDING, std::memory_order_acq_rel)) return false;
+
+    MoveList moves;
+    position.generateMoves(moves);
+    uint32_t base = 0;
+    if (!moves.empty()) {
+        base = allocate(static_cast<size_t>(moves.size()));
+        if (base == NO_NODE) {
+            target.state.store(UNEXPANDED, std::memory_order_release);
+            return false;
+        }
+        for (int i = 0; i < moves.size(); ++i) {
+            Node& child = node(base + static_cast<uint32_t>(i));
+            child.firstChild = 0;
+            child.childCount = 0;
+            child.state.store(UNEXPANDED, std::memory_order_relaxed);
+            child.move = position.encodeMove(moves[i]);
+            child.visits.store(0, std::memory_order_relaxed);
+            child.score.store(0, std::memory_order_relaxed);
+            child.virtualLoss.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    target.firstChild = base;
+    target.childCount = static_cast<uint16_t>(moves.size());
+    target.state.store(EXPANDED, std::memory_order_release);
+    return true;
+}
+
+int MCTSEngine::playout(Worker& worker) {
+    return randomPlayout(worker.position, worker.rng, MAX_PLAYOUT_PLIES).winner;
+}
+
+uint32_t MCTSEngine::allocate(size_t count) {
+    std::atomic<size_t>& used = pools[active].used;
+    size_t start = used.load(std::memory_order_relaxed);
+    do {
+        if (start + count > nodeLimit) return NO_NODE;
+    } while (!used.compare_exchange_weak(start, start + count, std::memory_order_relaxed));
+    return static_cast<uint32_t>(start);
+}
+
+void MCTSEngine::resetTree(const GameModel& model) {
+    pools[active].used.store(0, std::memory_order_relaxed);
+    hasTree = true;
+    rootPosition = model;
+
+    uint32_t index = allocate(1);
+    if (index == NO_NODE) index = 0;   // The root always fits in the pool itself
+    pools[active].used.store(1, std::memory_order_relaxed);
+
+    Node& root = node(index);
+    root.firstChild = 0;
+    root.childCount = 0;
+    root.state.store(UNEXPANDED, std::memory_order_relaxed);
+    root.move = CompactMove();
+    root.visits.store(0, std::memory_order_relaxed);
+    root.score.store(0, std::memory_order_relaxed);
+    root.virtualLoss.store(0, std::memory_order_relaxed);
+}
+
+bool MCTSEngine::reuseTree(const GameModel& model) {
+    if (!hasTree) return false;
+    if (rootPosition.getHash() == model.getHash()) return true;
+
+    // Look for the position one or two plies below the old root: usually
+    // our move followed by the opponent's reply
+    const Node& root = node(0);
+    if (root.state.load(std::memory_order_acquire) != EXPANDED) return false;
+    for (uint32_t child = root.firstChild; child < root.firstChild + root.childCount; ++child) {
+        GameModel afterChild(rootPosition);
+        afterChild.makeMove(node(child).move);
+        if (afterChild.getHash() == model.getHash()) {
+            compact(child);
+            rootPosition = model;
+            return true;
+        }
+
+        const Node& middle = node(child);
+        if (middle.state.load(std::memory_order_acquire) != EXPANDED) continue;
+        for (uint32_t grandchild = middle.firstChild; grandchild < middle.firstChild + middle.childCount; ++grandchild) {
+            GameModel afterGrandchild(afterChild);
+            afterGrandchild.makeMove(node(grandchild).move);
+            if (afterGrandchild.getHash() == model.getHash()) {
+                compact(grandchild);
+                rootPosition = model;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void MCTSEngine::compact(uint32_t newRoot) {
+    NodePool& from = pools[active];
+    NodePool& to = pools[1 - active];
+
+    auto copy = [](Node& target, const Node& source) {
+        target.firstChild = source.firstChild;
+        target.childCount = source.childCount;
+        target.state.store(source.state.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        target.move = source.move;
+        target.visits.store(source.visits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        target.score.store(source.score.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        target.virtualLoss.store(0, std::memory_order_relaxed);
+    };
+
+    // Breadth-first, so every copied node's children stay contiguous
+    std::vector<std::pair<uint32_t, uint32_t>> queue;   // (old index, new index)
+    copy(to.nodes[0], from.nodes[newRoot]);
+    to.nodes[0].move = CompactMove();
+    queue.emplace_back(newRoot, 0);
+    size_t used = 1;
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const Node& source = from.nodes[queue[head].first];
+        Node& target = to.nodes[queue[head].second];
+        if (source.state.load(std::memory_order_relaxed) != EXPANDED || source.childCount == 0) continue;
+
+        uint32_t base = static_cast<uint32_t>(used);
+        used += source.childCount;
+        target.firstChild = base;
+        for (uint32_t k = 0; k < source.childCount; ++k) {
+            copy(to.nodes[base + k], from.nodes[source.firstChild + k]);
+            queue.emplace_back(source.firstChild + k, base + k);
+        }
+    }
+
+    to.used.store(used, std::memory_order_relaxed);
+    from.used.store(0, std::memory_order_relaxed);
+    active = 1 - active;
+}
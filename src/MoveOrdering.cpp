@@ -0,0 +1,86 @@
+#include "MoveOrdering.h"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+void MoveOrdering::clear() {
+    for (auto& ply : killers) {
+        ply[0] = 0;
+        ply[1] = 0;
+    }
+    for (auto& side : history) {
+        for (auto& from : side) {
+            std::fill(std::begin(from), std::end(from), 0);
+        }
+    }
+}
+
+void MoveOrdering::scoreMoves(const BitBoard& board, int side, const MoveList& moves,
+                              CompactMove ttMove, int ply, int* scores) const {
+    uint32_t ttCaptured = ttMove.capturedMask();
+    uint32_t promotionSquares = promotionRow(side);
+    uint16_t killer0 = killers[ply][0];
+    uint16_t killer1 = killers[ply][1];
+
+    for (int i = 0; i < moves.size(); ++i) {
+        const MoveList::Entry& move = moves[i];
+        int to = move.to();
+
+        if (!ttMove.isNull() && move.from == ttMove.from() && to == ttMove.to() &&
+            move.capturedMask == ttCaptured) {
+            scores[i] = TT_MOVE_SCORE;
+        } else if (move.isCapture()) {
+            scores[i] = CAPTURE_SCORE + move.captureCount() * 64 + popCount(move.capturedMask & board.dames);
+        } else if (!((board.dames >> move.from) & 1u) && ((promotionSquares >> to) & 1u)) {
+            scores[i] = PROMOTION_SCORE;
+        } else {
+            uint16_t key = killerKey(move.from, to);
+            if (key == killer0) {
+                scores[i] = KILLER_SCORE + 1;
+            } else if (key == killer1) {
+                scores[i] = KILLER_SCORE;
+            } else {
+                scores[i] = history[side][move.from][to];
+            }
+        }
+    }
+}
+
+void MoveOrdering::pickNext(MoveList& moves, int* scores, int index) {
+    int best = index;
+    for (int i = index + 1; i < moves.size(); ++i) {
+        if (scores[i] > scores[best]) best = i;
+    }
+    if (best != index) {
+        std::swap(moves[index], moves[best]);
+        std::swap(scores[index], scores[best]);
+    }
+}
+
+void MoveOrdering::recordCutoff(const MoveList& moves, int cutoffIndex, int side, int ply, int depth) {
+    const MoveList::Entry& move = moves[cutoffIndex];
+    if (move.isCapture()) return;
+
+    uint16_t key = killerKey(move.from, move.to());
+    if (killers[ply][0] != key) {
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = key;
+    }
+
+    int bonus = std::min(depth * depth, MAX_HISTORY / 4);
+    updateHistory(side, move.from, move.to(), bonus);
+    for (int i = 0; i < cutoffIndex; ++i) {
+        updateHistory(side, moves[i].from, moves[i].to(), -bonus);
+    }
+}
+
+bool MoveOrdering::isKiller(int ply, int from, int to) const {
+    uint16_t key = killerKey(from, to);
+    return killers[ply][0] == key || killers[ply][1] == key;
+}
+
+void MoveOrdering::updateHistory(int side, int from, int to, int bonus) {
+    // Gravity keeps values within +-MAX_HISTORY and lets old results fade
+    int& entry = history[side][from][to];
+    entry += bonus - entry * std::abs(bonus) / MAX_HISTORY;
+}
@@ -0,0 +1,143 @@
+#include "OpeningBook.h"
+#include "MoveList.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+void OpeningBookBuilder::addGame(const GameModel& start, const std::vector<Move>& moves, int winner) {
+    GameModel model(start);
+    ++games;
+
+    int plies = std::min(static_cast<int>(moves.size()), maxPly);
+    for (int ply = 0; ply < plies; ++ply) {
+        if (!addMove(model, model.encodeMove(moves[ply]), winner)) break;
+    }
+}
+
+void OpeningBookBuilder::addGame(const GameModel& start, const std::vector<CompactMove>& moves, int winner) {
+    GameModel model(start);
+    ++games;
+
+    int plies = std::min(static_cast<int>(moves.size()), maxPly);
+    for (int ply = 0; ply < plies; ++ply) {
+        if (!addMove(model, moves[ply], winner)) break;
+    }
+}
+
+bool OpeningBookBuilder::addMove(GameModel& model, CompactMove move, int winner) {
+    int side = model.getCurrentSide();
+    if (side == NO_SIDE) return false;
+
+    // encodeMove doesn't check legality, so match against the generator
+    MoveList legal;
+    model.generateMoves(legal);
+    bool found = false;
+    for (const auto& entry : legal) {
+        if (model.encodeMove(entry) == move) {
+            found = true;
+            break;
+        }
+    }
+    if (!found) return false;
+
+    Stats& entry = stats[{model.getHash(), move.raw()}];
+    ++entry.plays;
+    if (winner == side) ++entry.wins;
+    else if (winner == 1 - side) ++entry.losses;
+
+    model.makeMove(move);
+    return true;
+}
+
+bool OpeningBookBuilder::write(const std::string& path, uint32_t minPlays) const {
+    std::vector<BookEntry> entries;
+    for (const auto& item : stats) {
+        if (item.second.plays < minPlays) continue;
+        entries.push_back(BookEntry{item.first.first, item.first.second,
+                                    item.second.plays, item.second.wins, item.second.losses});
+    }
+
+    BookHeader header{};
+    std::copy(OpeningBook::MAGIC, OpeningBook::MAGIC + sizeof(OpeningBook::MAGIC), header.magic);
+    header.version = OpeningBook::VERSION;
+    header.entries = entries.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()),
+              static_cast<std::streamsize>(entries.size() * sizeof(BookEntry)));
+    return static_cast<bool>(out);
+}
+
+bool OpeningBook::open(const std::string& path) {
+    close();
+
+    MappedFile mapped;
+    if (!mapped.open(path) || mapped.size() < sizeof(BookHeader)) return false;
+
+    BookHeader header;
+    std::memcpy(&header, mapped.data(), sizeof(header));
+    // Divide rather than multiply so a corrupt entry count can't overflow
+    size_t body = mapped.size() - sizeof(BookHeader);
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+        body % sizeof(BookEntry) != 0 || header.entries != body / sizeof(BookEntry)) {
+        return false;
+    }
+
+    file = std::move(mapped);
+    count = static_cast<size_t>(header.entries);
+    return true;
+}
+
+void OpeningBook::close() {
+    file.close();
+    count = 0;
+}
+
+std::vector<BookEntry> OpeningBook::lookup(uint64_t key) const {
+    std::vector<BookEntry> result;
+    if (count == 0) return result;
+
+    const BookEntry* begin = entries();
+    const BookEntry* end = begin + count;
+    auto first = std::lower_bound(begin, end, key, [](const BookEntry& entry, uint64_t value) {
+        return entry.key < value;
+    });
+    for (auto it = first; it != end && it->key == key; ++it) result.push_back(*it);
+    return result;
+}
+
+bool OpeningBook::probe(const GameModel& model, Move& move) const {
+    if (model.getCurrentSide() == NO_SIDE) return false;
+    std::vector<BookEntry> candidates = lookup(model.getHash());
+    if (candidates.empty()) return false;
+
+    MoveList legal;
+    model.generateMoves(legal);
+
+    const BookEntry* best = nullptr;
+    int bestIndex = -1;
+    for (const auto& candidate : candidates) {
+        // A hash collision could suggest a move from another position
+        int index = -1;
+        for (int i = 0; i < legal.size(); ++i) {
+            if (model.encodeMove(legal[i]).raw() == candidate.move) {
+                index = i;
+                break;
+            }
+        }
+        if (index < 0) continue;
+
+        int64_t margin = static_cast<int64_t>(candidate.wins) - candidate.losses;
+        if (!best || candidate.plays > best->plays ||
+            (candidate.plays == best->plays && margin > static_cast<int64_t>(best->wins) - best->losses)) {
+            best = &candidate;
+            bestIndex = index;
+        }
+    }
+    if (!best) return false;
+
+    move = model.toMove(legal[bestIndex]);
+    return true;
+}
@@ -0,0 +1,123 @@
+#include "Perft.h"
+#include "MoveList.h"
+
+Perft::Perft(size_t hashMB, unsigned threads) {
+    if (threads != 1) {
+        pool = std::make_unique<ThreadPool>(threads);
+        if (pool->size() == 1) pool.reset();
+    }
+    if (hashMB == 0) return;
+
+    size_t available = (hashMB << 20) / sizeof(HashEntry);
+    tableSize = 1;
+    while (tableSize * 2 <= available) tableSize *= 2;
+    table.reset(new HashEntry[tableSize]);
+}
+
+void Perft::clearHash() {
+    for (size_t i = 0; i < tableSize; ++i) {
+        table[i].data.store(0, std::memory_order_relaxed);
+        table[i].check.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Perft::count(GameModel& model, int depth) {
+    if (depth <= 0) return 1;
+    return pool ? countSplit(model, depth) : countNode(model, depth);
+}
+
+std::vector<Perft::DivideEntry> Perft::divide(GameModel& model, int depth) {
+    std::vector<DivideEntry> result;
+    if (depth <= 0) return result;
+
+    MoveList moves;
+    model.generateMoves(moves);
+    for (const auto& entry : moves) {
+        result.push_back(DivideEntry{model.toMove(entry), 0});
+    }
+
+    if (!pool) {
+        for (int i = 0; i < moves.size(); ++i) {
+            GameModel::UndoInfo undo = model.makeMove(moves[i]);
+            result[i].nodes = count(model, depth - 1);
+            model.unmakeMove(undo);
+        }
+        return result;
+    }
+
+    ThreadPool::TaskGroup group;
+    for (int i = 0; i < moves.size(); ++i) {
+        GameModel child(model);
+        child.makeMove(moves[i]);
+        pool->submit(group, [this, &result, i, child, depth]() mutable {
+            result[i].nodes = depth > 1 ? countSplit(child, depth - 1) : 1;
+        });
+    }
+    pool->wait(group);
+    return result;
+}
+
+bool Perft::probe(uint64_t key, int depth, uint64_t& nodes) const {
+    const HashEntry& slot = table[key & (tableSize - 1)];
+    uint64_t data = slot.data.load(std::memory_order_relaxed);
+    uint64_t check = slot.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != key || static_cast<int>(data >> DEPTH_SHIFT) != depth) return false;
+
+    nodes = data & NODE_MASK;
+    return true;
+}
+
+void Perft::store(uint64_t key, int depth, uint64_t nodes) {
+    HashEntry& slot = table[key & (tableSize - 1)];
+    uint64_t data = (static_cast<uint64_t>(depth) << DEPTH_SHIFT) | (nodes & NODE_MASK);
+    slot.data.store(data, std::memory_order_relaxed);
+    slot.check.store(key ^ data, std::memory_order_relaxed);
+}
+
+uint64_t Perft::countNode(GameModel& model, int depth) {
+    MoveList moves;
+    model.generateMoves(moves);
+    
+    // Bulk count at the frontier: every legal move is one leaf
+    if (depth == 1) return static_cast<uint64_t>(moves.size());
+
+    uint64_t key = model.getHash();
+    uint64_t nodes = 0;
+    if (tableSize && probe(key, depth, nodes)) return nodes;
+
+    for (const auto& entry : moves) {
+        GameModel::UndoInfo undo = model.makeMove(entry);
+        nodes += countNode(model, depth - 1);
+        model.unmakeMove(undo);
+    }
+
+    if (tableSize) store(key, depth, nodes);
+    return nodes;
+}
+
+uint64_t Perft::countSplit(GameModel& model, int depth) {
+    if (depth < MIN_SPLIT_DEPTH) return countNode(model, depth);
+
+    uint64_t key = model.getHash();
+    uint64_t nodes = 0;
+    if (tableSize && probe(key, depth, nodes)) return nodes;
+
+    MoveList moves;
+    model.generateMoves(moves);
+    
+    // Each child writes its own slot; the ordered sum keeps results reproducible
+    std::vector<uint64_t> childNodes(moves.size(), 0);
+    ThreadPool::TaskGroup group;
+    for (int i = 0; i < moves.size(); ++i) {
+        GameModel child(model);
+        child.makeMove(moves[i]);
+        pool->submit(group, [this, &childNodes, i, child, depth]() mutable {
+            childNodes[i] = countSplit(child, depth - 1);
+        });
+    }
+    pool->wait(group);
+
+    for (uint64_t childCount : childNodes) nodes += childCount;
+    if (tableSize) store(key, depth, nodes);
+    return nodes;
+}
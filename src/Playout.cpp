@@ -0,0 +1,140 @@
+#include "Playout.h"
+#include "MoveList.h"
+#include "MoveTables.h"
+
+namespace {
+    // All a playout needs of a move
+    struct PlayoutMove {
+        uint32_t captured;
+        uint8_t from;
+        uint8_t to;
+    };
+
+    struct PlayoutMoves {
+        PlayoutMove moves[MAX_MOVES];
+        int count = 0;
+
+        void add(int from, int to, uint32_t captured) {
+            if (count < MAX_MOVES) moves[count++] = {captured, static_cast<uint8_t>(from), static_cast<uint8_t>(to)};
+        }
+    };
+
+    // The capture walkers mirror GameModel's: captured pieces and the
+    // mover's starting square stay occupied until the move is played, and
+    // only maximal sequences are moves
+    void addPionCaptures(const BitBoard& board, int side, uint32_t empty, int from, int current,
+                         uint32_t captured, PlayoutMoves& out) {
+        bool found = false;
+        uint32_t enemies = board.pieces[1 - side] & ~captured;
+        for (int i = 0; i < 2; ++i) {
+            uint32_t enemy = MOVE_TABLES.pionStep[side][current][i] & enemies;
+            uint32_t landing = MOVE_TABLES.pionJump[side][current][i] & empty;
+            if (!enemy || !landing) continue;
+            found = true;
+            addPionCaptures(board, side, empty, from, lowestSquare(landing), captured | enemy, out);
+        }
+        if (!found && captured) out.add(from, current, captured);
+    }
+
+    void addDameCaptures(const BitBoard& board, int side, uint32_t empty, int from, int current,
+                         uint32_t captured, PlayoutMoves& out) {
+        bool found = false;
+        uint32_t enemies = board.pieces[1 - side] & ~captured;
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            const uint32_t* ray = MOVE_TABLES.ray[current][dir];
+            while (*ray & empty) ++ray;
+            uint32_t landing = ray[1] & empty;
+            if (!(*ray & enemies) || !landing) continue;
+            found = true;
+            addDameCaptures(board, side, empty, from, lowestSquare(landing), captured | *ray, out);
+        }
+        if (!found && captured) out.add(from, current, captured);
+    }
+
+    // Whether any piece has a first jump, by whole-board shifts for the
+    // Pions; most positions have none, which skips the capture walkers
+    bool hasCapture(const BitBoard& board, int side, uint32_t empty) {
+        uint32_t enemies = board.pieces[1 - side];
+        uint32_t pions = board.pions(side);
+        for (int dir : PION_DIRECTIONS[side]) {
+            if (shiftSquares(shiftSquares(pions, dir) & enemies, dir) & empty) return true;
+        }
+        for (uint32_t mask = board.damesOf(side); mask; ) {
+            int square = popLowestSquare(mask);
+            for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+                const uint32_t* ray = MOVE_TABLES.ray[square][dir];
+                while (*ray & empty) ++ray;
+                if ((*ray & enemies) && (ray[1] & empty)) return true;
+            }
+        }
+        return false;
+    }
+
+    void generate(const BitBoard& board, int side, PlayoutMoves& out) {
+        out.count = 0;
+        uint32_t empty = board.empty();
+        uint32_t own = board.pieces[side];
+
+        for (uint32_t mask = hasCapture(board, side, empty) ? own : 0; mask; ) {
+            int square = popLowestSquare(mask);
+            if ((board.dames >> square) & 1u) {
+                addDameCaptures(board, side, empty, square, square, 0, out);
+            } else {
+                addPionCaptures(board, side, empty, square, square, 0, out);
+            }
+        }
+        if (out.count) return;   // Capturing is mandatory
+
+        for (uint32_t mask = own; mask; ) {
+            int square = popLowestSquare(mask);
+            if ((board.dames >> square) & 1u) {
+                for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+                    for (const uint32_t* dest = MOVE_TABLES.ray[square][dir]; *dest & empty; ++dest) {
+                        out.add(square, lowestSquare(*dest), 0);
+                    }
+                }
+            } else {
+                for (int i = 0; i < 2; ++i) {
+                    uint32_t dest = MOVE_TABLES.pionStep[side][square][i] & empty;
+                    if (dest) out.add(square, lowestSquare(dest), 0);
+                }
+            }
+        }
+    }
+
+    void play(BitBoard& board, int side, const PlayoutMove& move) {
+        uint32_t fromBit = 1u << move.from;
+        uint32_t toBit = 1u << move.to;
+        board.pieces[side] ^= fromBit | toBit;
+        if (board.dames & fromBit) {
+            board.dames ^= fromBit | toBit;
+        } else {
+            board.dames |= toBit & promotionRow(side);
+        }
+        board.pieces[1 - side] &= ~move.captured;
+        board.dames &= ~move.captured;
+    }
+}
+
+PlayoutResult randomPlayout(const BitBoard& start, int sideToMove, Xoshiro256& rng, int maxPlies) {
+    PlayoutResult result;
+    if (sideToMove == NO_SIDE) return result;
+
+    BitBoard board = start;
+    int side = sideToMove;
+    PlayoutMoves moves;
+    for (; result.plies < maxPlies; ++result.plies) {
+        generate(board, side, moves);
+        if (moves.count == 0) {
+            result.winner = 1 - side;
+            return result;
+        }
+        play(board, side, moves.moves[rng.below(static_cast<uint32_t>(moves.count))]);
+        side = 1 - side;
+    }
+    return result;
+}
+
+PlayoutResult randomPlayout(const GameModel& model, Xoshiro256& rng, int maxPlies) {
+    return randomPlayout(model.getBitBoard(), model.getCurrentSide(), rng, maxPlies);
+}
@@ -0,0 +1,334 @@
+#include "SearchEngine.h"
+#include "Evaluation.h"
+#include "MoveList.h"
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+    // How often the clock is read and node counts are published, in nodes
+    constexpr uint64_t CHECK_INTERVAL = 1024;
+
+    // Lazy SMP depth skipping: helper i searches depth d unless
+    // ((d + SKIP_PHASE[i]) / SKIP_SIZE[i]) is odd, so helpers spread
+    // over the next few depths instead of repeating the main thread
+    constexpr int SKIP_PATTERNS = 20;
+    constexpr int SKIP_SIZE[SKIP_PATTERNS] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+    constexpr int SKIP_PHASE[SKIP_PATTERNS] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+    bool skipsDepth(int threadId, int depth) {
+        if (threadId == 0) return false;
+        int pattern = (threadId - 1) % SKIP_PATTERNS;
+        return ((depth + SKIP_PHASE[pattern]) / SKIP_SIZE[pattern]) % 2 != 0;
+    }
+}
+
+SearchEngine::SearchEngine(size_t hashMB, unsigned threadCount) : table(hashMB) {
+    setThreads(threadCount);
+}
+
+SearchEngine::~SearchEngine() = default;
+
+void SearchEngine::setThreads(unsigned threadCount) {
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+
+    threads.clear();
+    for (unsigned i = 0; i < threadCount; ++i) {
+        threads.push_back(std::make_unique<SearchThread>());
+        threads.back()->id = static_cast<int>(i);
+    }
+    pool.reset();
+    if (threadCount > 1) pool = std::make_unique<ThreadPool>(threadCount - 1);
+}
+
+SearchResult SearchEngine::search(const GameModel& model, const SearchLimits& searchLimits) {
+    limits = searchLimits;
+    startTime = std::chrono::steady_clock::now();
+    stopSignal.store(false, std::memory_order_relaxed);
+    sharedNodes.store(0, std::memory_order_relaxed);
+    table.newSearch();
+
+    for (auto& thread : threads) {
+        thread->position = model;
+        thread->nodes = 0;
+        thread->flushedNodes = 0;
+        thread->stopped = false;
+        thread->ordering.clear();
+    }
+
+    SearchResult result;
+    MoveList rootMoves;
+    model.generateMoves(rootMoves);
+    if (rootMoves.empty()) {
+        result.score = -MATE_SCORE;
+        return result;
+    }
+
+    if (book && book->probe(model, result.bestMove)) {
+        result.pv = {result.bestMove};
+        result.fromBook = true;
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        return result;
+    }
+
+    // Something to play even if the first iteration is cut short
+    result.bestMove = model.toMove(rootMoves[0]);
+    result.pv = {result.bestMove};
+
+    ThreadPool::TaskGroup helpers;
+    for (size_t i = 1; i < threads.size(); ++i) {
+        SearchThread* helper = threads[i].get();
+        pool->submit(helpers, [this, helper]() { iterate(*helper, nullptr); });
+    }
+
+    iterate(*threads[0], &result);
+
+    // The main thread's last iteration is the answer; helpers just stop
+    stopSignal.store(true, std::memory_order_relaxed);
+    if (pool) pool->wait(helpers);
+
+    result.nodes = 0;
+    for (const auto& thread : threads) result.nodes += thread->nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return result;
+}
+
+void SearchEngine::iterate(SearchThread& thread, SearchResult* result) {
+    int maxDepth = std::min(std::max(limits.maxDepth, 1), MAX_PLY - 1);
+    for (int depth = 1; depth <= maxDepth; ++depth) {
+        if (skipsDepth(thread.id, depth)) continue;
+
+        thread.keyStack[0] = thread.position.getHash();
+        int score = negamax(thread, depth, 0, -INFINITE_SCORE, INFINITE_SCORE);
+        if (thread.stopped) break;
+        if (!result) continue;
+
+        result->score = score;
+        result->depth = depth;
+        result->pv = extractPv(thread);
+        if (!result->pv.empty()) result->bestMove = result->pv.front();
+
+        // A forced result won't change with more depth
+        if (isMateScore(score) && MATE_SCORE - std::abs(score) <= depth) break;
+    }
+}
+
+int SearchEngine::negamax(SearchThread& thread, int depth, int ply, int alpha, int beta) {
+    if (depth <= 0) return quiescence(thread, ply, alpha, beta);
+
+    thread.pvLength[ply] = ply;
+    if (shouldStop(thread)) return 0;
+    ++thread.nodes;
+
+    if (ply > 0 && isRepetition(thread, ply)) return 0;
+
+    int tableScore = 0;
+    if (ply > 0 && probeTablebase(thread, ply, tableScore)) return tableScore;
+
+    GameModel& position = thread.position;
+    bool pvNode = beta - alpha > 1;
+    uint64_t key = position.getHash();
+    TranspositionTable::Entry entry;
+    CompactMove ttMove;
+    if (table.probe(key, entry)) {
+        ttMove = entry.bestMove;
+        if (ply > 0 && !pvNode && entry.depth >= depth) {
+            int score = fromTableScore(entry.score, ply);
+            if (entry.bound == TranspositionTable::Bound::Exact ||
+                (entry.bound == TranspositionTable::Bound::Lower && score >= beta) ||
+                (entry.bound == TranspositionTable::Bound::Upper && score <= alpha)) {
+                return score;
+            }
+        }
+    }
+
+    MoveList moves;
+    position.generateMoves(moves);
+    if (moves.empty()) return -MATE_SCORE + ply;
+    if (ply >= MAX_PLY - 1) return evaluate(thread);
+
+    int side = position.getCurrentSide();
+    int scores[MAX_MOVES];
+    thread.ordering.scoreMoves(position.getBitBoard(), side, moves, ttMove, ply, scores);
+
+    int originalAlpha = alpha;
+    int bestScore = -INFINITE_SCORE;
+    CompactMove bestMove;
+
+    for (int i = 0; i < moves.size(); ++i) {
+        MoveOrdering::pickNext(moves, scores, i);
+        GameModel::UndoInfo undo = position.makeMove(moves[i]);
+        thread.keyStack[ply + 1] = position.getHash();
+
+        // Principal variation search: the first move gets the full window,
+        // the rest only have to prove they are no better
+        int score;
+        if (i == 0) {
+            score = -negamax(thread, depth - 1, ply + 1, -beta, -alpha);
+        } else {
+            score = -negamax(thread, depth - 1, ply + 1, -alpha - 1, -alpha);
+            if (score > alpha && score < beta) {
+                score = -negamax(thread, depth - 1, ply + 1, -beta, -alpha);
+            }
+        }
+        position.unmakeMove(undo);
+        if (thread.stopped) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = position.encodeMove(moves[i]);
+            if (score > alpha) {
+                alpha = score;
+                updatePv(thread, ply, bestMove);
+                if (alpha >= beta) {
+                    thread.ordering.recordCutoff(moves, i, side, ply, depth);
+                    break;
+                }
+            }
+        }
+    }
+
+    TranspositionTable::Bound bound = bestScore >= beta ? TranspositionTable::Bound::Lower
+                                    : bestScore > originalAlpha ? TranspositionTable::Bound::Exact
+                                    : TranspositionTable::Bound::Upper;
+    table.store(key, depth, toTableScore(bestScore, ply), bound, bestMove);
+    return bestScore;
+}
+
+int SearchEngine::quiescence(SearchThread& thread, int ply, int alpha, int beta) {
+    thread.pvLength[ply] = ply;
+    if (shouldStop(thread)) return 0;
+    ++thread.nodes;
+
+    int tableScore = 0;
+    if (ply > 0 && probeTablebase(thread, ply, tableScore)) return tableScore;
+
+    GameModel& position = thread.position;
+    MoveList moves;
+    position.generateCaptures(moves);
+
+    // A quiet position is scored as it stands; a blocked one is lost
+    if (moves.empty()) {
+        return position.hasQuietMove() ? evaluate(thread) : -MATE_SCORE + ply;
+    }
+    if (ply >= MAX_PLY - 1) return evaluate(thread);
+
+    // Captures are mandatory, so there is no standing pat: the side to
+    // move must play one of them
+    int scores[MAX_MOVES];
+    thread.ordering.scoreMoves(position.getBitBoard(), position.getCurrentSide(), moves,
+                               CompactMove(), ply, scores);
+
+    int bestScore = -INFINITE_SCORE;
+    for (int i = 0; i < moves.size(); ++i) {
+        MoveOrdering::pickNext(moves, scores, i);
+        GameModel::UndoInfo undo = position.makeMove(moves[i]);
+        int score = -quiescence(thread, ply + 1, -beta, -alpha);
+        position.unmakeMove(undo);
+        if (thread.stopped) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            if (score > alpha) {
+                alpha = score;
+                updatePv(thread, ply, position.encodeMove(moves[i]));
+                if (alpha >= beta) break;
+            }
+        }
+    }
+    return bestScore;
+}
+
+int SearchEngine::evaluate(const SearchThread& thread) const {
+    return Evaluation::evaluate(thread.position);
+}
+
+bool SearchEngine::probeTablebase(const SearchThread& thread, int ply, int& score) const {
+    Tablebase::Result result;
+    if (!tablebase || !tablebase->probe(thread.position, result)) return false;
+
+    // Keep tabled distances inside the mate range
+    int plies = std::min(ply + result.distance, MAX_PLY - 1);
+    switch (result.outcome) {
+        case Tablebase::Outcome::Win:  score = MATE_SCORE - plies; break;
+        case Tablebase::Outcome::Loss: score = -MATE_SCORE + plies; break;
+        case Tablebase::Outcome::Draw: score = 0; break;
+    }
+    return true;
+}
+
+bool SearchEngine::isRepetition(const SearchThread& thread, int ply) const {
+    // Only positions with the same side to move can repeat
+    for (int i = ply - 2; i >= 0; i -= 2) {
+        if (thread.keyStack[i] == thread.keyStack[ply]) return true;
+    }
+    return false;
+}
+
+bool SearchEngine::shouldStop(SearchThread& thread) {
+    if (thread.stopped) return true;
+    if (stopSignal.load(std::memory_order_relaxed)) {
+        thread.stopped = true;
+        return true;
+    }
+
+    if (limits.maxNodes) {
+        uint64_t total = sharedNodes.load(std::memory_order_relaxed) + thread.nodes - thread.flushedNodes;
+        if (total >= limits.maxNodes) {
+            stopSignal.store(true, std::memory_order_relaxed);
+            thread.stopped = true;
+            return true;
+        }
+    }
+
+    if (thread.nodes - thread.flushedNodes >= CHECK_INTERVAL) {
+        sharedNodes.fetch_add(thread.nodes - thread.flushedNodes, std::memory_order_relaxed);
+        thread.flushedNodes = thread.nodes;
+
+        // Only the main thread watches the clock
+        if (thread.id == 0 && limits.maxTimeMs > 0) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - startTime).count();
+            if (elapsed >= limits.maxTimeMs) {
+                stopSignal.store(true, std::memory_order_relaxed);
+                thread.stopped = true;
+            }
+        }
+    }
+    return thread.stopped;
+}
+
+void SearchEngine::updatePv(SearchThread& thread, int ply, CompactMove move) {
+    thread.pvTable[ply][ply] = move;
+    for (int next = ply + 1; next < thread.pvLength[ply + 1]; ++next) {
+        thread.pvTable[ply][next] = thread.pvTable[ply + 1][next];
+    }
+    thread.pvLength[ply] = thread.pvLength[ply + 1];
+}
+
+std::vector<Move> SearchEngine::extractPv(const SearchThread& thread) const {
+    // Decode each move in the position it is played from
+    std::vector<Move> pv;
+    GameModel line = thread.position;
+    for (int ply = 0; ply < thread.pvLength[0]; ++ply) {
+        Move move = line.decodeMove(thread.pvTable[0][ply]);
+        if (move.path.empty()) break;
+        line.makeMove(thread.pvTable[0][ply]);
+        pv.push_back(move);
+    }
+    return pv;
+}
+
+int SearchEngine::toTableScore(int score, int ply) {
+    // Mate scores are stored relative to the node, not the root
+    if (score > MATE_BOUND) return score + ply;
+    if (score < -MATE_BOUND) return score - ply;
+    return score;
+}
+
+int SearchEngine::fromTableScore(int score, int ply) {
+    if (score > MATE_BOUND) return score - ply;
+    if (score < -MATE_BOUND) return score + ply;
+    return score;
+}
@@ -0,0 +1,151 @@
+#include "SelfPlay.h"
+#include "ThreadPool.h"
+#include "Zobrist.h"
+#include <condition_variable>
+#include <mutex>
+
+namespace {
+    struct Slot {
+        GameRecord record;
+        bool done = false;
+    };
+
+    uint64_t gameSeed(uint64_t seed, uint64_t index) {
+        uint64_t state = seed ^ (index * 0xD1B54A32D192ED03ull);
+        return splitMix64(state);
+    }
+}
+
+int RandomPolicy::select(const GameModel&, const MoveList& moves, std::mt19937_64& rng) {
+    return static_cast<int>(rng() % static_cast<uint64_t>(moves.size()));
+}
+
+int FirstLegalPolicy::select(const GameModel&, const MoveList&, std::mt19937_64&) {
+    return 0;
+}
+
+SearchPolicy::SearchPolicy(const SearchLimits& searchLimits, size_t hashMB)
+    : engine(hashMB, 1), limits(searchLimits) {}
+
+int SearchPolicy::select(const GameModel& model, const MoveList& moves, std::mt19937_64&) {
+    SearchResult result = engine.search(model, limits);
+    if (!result.hasMove()) return 0;
+
+    CompactMove best = model.encodeMove(result.bestMove);
+    for (int i = 0; i < moves.size(); ++i) {
+        if (model.encodeMove(moves[i]) == best) return i;
+    }
+    return 0;
+}
+
+PolicyFactory makePolicyFactory(const std::string& name, const SearchLimits& limits) {
+    if (name == "random") return [] { return std::make_unique<RandomPolicy>(); };
+    if (name == "first") return [] { return std::make_unique<FirstLegalPolicy>(); };
+    if (name == "search") return [limits] { return std::make_unique<SearchPolicy>(limits); };
+    return PolicyFactory();
+}
+
+SelfPlayRunner::SelfPlayRunner(PolicyFactory player1, PolicyFactory player2)
+    : factories{std::move(player1), std::move(player2)} {}
+
+GameRecord SelfPlayRunner::playGame(uint64_t index, const SelfPlayConfig& config) const {
+    GameRecord record;
+    record.index = index;
+
+    std::mt19937_64 rng(gameSeed(config.seed, index));
+    std::unique_ptr<MovePolicy> policies[NUM_SIDES] = {factories[0](), factories[1]()};
+
+    GameModel model;
+    model.initializeStandardGame("Player1", "Player2");
+    MoveList moves;
+    for (int ply = 0; ply < config.maxPlies; ++ply) {
+        model.generateMoves(moves);
+        int side = model.getCurrentSide();
+        if (moves.empty()) {
+            record.winner = 1 - side;
+            break;
+        }
+
+        const MoveList::Entry& entry = moves[policies[side]->select(model, moves, rng)];
+        record.moves.push_back(model.encodeMove(entry));
+        model.makeMove(entry);
+    }
+    return record;
+}
+
+SelfPlayRunner::Summary SelfPlayRunner::run(const SelfPlayConfig& config, const Sink& sink) {
+    Summary summary;
+    auto deliver = [&](const GameRecord& record) {
+        ++summary.games;
+        summary.plies += record.moves.size();
+        if (record.winner == NO_SIDE) ++summary.draws;
+        else ++summary.wins[record.winner];
+        if (sink) sink(record);
+    };
+
+    std::unique_ptr<ThreadPool> pool;
+    if (config.threads != 1) {
+        pool = std::make_unique<ThreadPool>(config.threads);
+        if (pool->size() == 1) pool.reset();
+    }
+    if (!pool) {
+        for (uint64_t i = 0; i < config.games; ++i) deliver(playGame(i, config));
+        return summary;
+    }
+
+    // Games nextDue..nextTaken-1 are in flight, each in slot index % size:
+    // workers take them in game order, at most a window ahead of the next
+    // one due, and that one is delivered as soon as it's done
+    std::vector<Slot> slots(WINDOW_SIZE);
+    std::mutex mutex;
+    std::condition_variable slotFree;
+    uint64_t nextTaken = 0;
+    uint64_t nextDue = 0;
+    bool delivering = false;
+
+    auto work = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            slotFree.wait(lock, [&]() { return nextTaken == config.games || nextTaken - nextDue < slots.size(); });
+            if (nextTaken == config.games) return;
+
+            uint64_t index = nextTaken++;
+            if (nextTaken == config.games) slotFree.notify_all();
+            Slot& slot = slots[index % slots.size()];
+            lock.unlock();
+            slot.record = playGame(index, config);
+            lock.lock();
+            slot.done = true;
+
+            // One worker at a time delivers, outside the lock, so the sink
+            // never blocks the others from taking games
+            if (delivering) continue;
+            delivering = true;
+            while (nextDue < nextTaken && slots[nextDue % slots.size()].done) {
+                Slot& due = slots[nextDue % slots.size()];
+                lock.unlock();
+                deliver(due.record);
+                lock.lock();
+                due.done = false;
+                ++nextDue;
+                slotFree.notify_one();
+            }
+            delivering = false;
+        }
+    };
+
+    ThreadPool::TaskGroup group;
+    for (unsigned i = 0; i < pool->size(); ++i) pool->submit(group, work);
+    pool->wait(group);
+    return summary;
+}
+
+void SelfPlayRunner::write(std::ostream& out, const GameRecord& record) {
+    out << record.index << ' '
+        << (record.winner == 0 ? "1-0" : record.winner == 1 ? "0-1" : "1/2") << ' '
+        << record.moves.size();
+    for (const auto& move : record.moves) {
+        out << ' ' << move.from() << (move.isCapture() ? 'x' : '-') << move.to();
+    }
+    out << '\n';
+}
@@ -0,0 +1,220 @@
+#include "Tablebase.h"
+#include "TablebaseGenerator.h"
+#include <cstring>
+#include <filesystem>
+
+namespace {
+    // Largest count Material::key() packs into its four bits
+    constexpr int MAX_MATERIAL_COUNT = 15;
+
+    struct BinomialTable {
+        uint64_t value[NUM_SQUARES + 1][NUM_SQUARES + 1] = {};
+    };
+
+    constexpr BinomialTable buildBinomials() {
+        BinomialTable table{};
+        for (int n = 0; n <= NUM_SQUARES; ++n) {
+            table.value[n][0] = 1;
+            for (int k = 1; k <= n; ++k) {
+                table.value[n][k] = table.value[n - 1][k - 1] + (k < n ? table.value[n - 1][k] : 0);
+            }
+        }
+        return table;
+    }
+
+    constexpr BinomialTable BINOMIALS = buildBinomials();
+
+    uint64_t choose(int n, int k) {
+        return k < 0 || k > n ? 0 : BINOMIALS.value[n][k];
+    }
+
+    // Placement order of the piece groups; see TablebaseIndex
+    constexpr int NUM_GROUPS = 4;
+
+    void groupSizes(const Material& material, int sizes[NUM_GROUPS]) {
+        sizes[0] = material.pions[0];
+        sizes[1] = material.pions[1];
+        sizes[2] = material.dames[0];
+        sizes[3] = material.dames[1];
+    }
+
+    void groupMasks(const BitBoard& board, uint32_t masks[NUM_GROUPS]) {
+        masks[0] = board.pions(0);
+        masks[1] = board.pions(1);
+        masks[2] = board.damesOf(0);
+        masks[3] = board.damesOf(1);
+    }
+
+    // Colex rank of the group's squares, numbered among the free squares
+    uint64_t rankGroup(uint32_t group, uint32_t occupied) {
+        uint64_t rank = 0;
+        int k = 1;
+        for (uint32_t mask = group; mask; ++k) {
+            int square = popLowestSquare(mask);
+            int freeBelow = popCount(~occupied & ((1u << square) - 1));
+            rank += choose(freeBelow, k);
+        }
+        return rank;
+    }
+
+    uint32_t unrankGroup(uint64_t rank, int count, uint32_t occupied) {
+        uint32_t freeSquares = ~occupied;
+        uint32_t group = 0;
+        int candidate = popCount(freeSquares) - 1;
+        for (int k = count; k >= 1; --k) {
+            while (choose(candidate, k) > rank) --candidate;
+            rank -= choose(candidate, k);
+
+            // The candidate-th free square, counting from zero
+            uint32_t mask = freeSquares;
+            for (int skip = 0; skip < candidate; ++skip) mask &= mask - 1;
+            group |= 1u << lowestSquare(mask);
+            --candidate;
+        }
+        return group;
+    }
+}
+
+Material Material::of(const BitBoard& board) {
+    Material material;
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        material.pions[side] = popCount(board.pions(side));
+        material.dames[side] = popCount(board.damesOf(side));
+    }
+    return material;
+}
+
+std::string Material::fileName() const {
+    return "x" + std::to_string(pions[0]) + "X" + std::to_string(dames[0]) +
+           "o" + std::to_string(pions[1]) + "O" + std::to_string(dames[1]) + ".tb";
+}
+
+uint64_t TablebaseIndex::size(const Material& material) {
+    int sizes[NUM_GROUPS];
+    groupSizes(material, sizes);
+
+    uint64_t placements = 1;
+    int freeSquares = NUM_SQUARES;
+    for (int group = 0; group < NUM_GROUPS; ++group) {
+        placements *= choose(freeSquares, sizes[group]);
+        freeSquares -= sizes[group];
+    }
+    return placements * NUM_SIDES;
+}
+
+uint64_t TablebaseIndex::index(const BitBoard& board, int side) {
+    uint32_t masks[NUM_GROUPS];
+    groupMasks(board, masks);
+
+    uint64_t index = 0;
+    uint32_t occupied = 0;
+    int freeSquares = NUM_SQUARES;
+    for (int group = 0; group < NUM_GROUPS; ++group) {
+        int count = popCount(masks[group]);
+        index = index * choose(freeSquares, count) + rankGroup(masks[group], occupied);
+        occupied |= masks[group];
+        freeSquares -= count;
+    }
+    return index * NUM_SIDES + static_cast<uint64_t>(side);
+}
+
+void TablebaseIndex::position(const Material& material, uint64_t index, BitBoard& board, int& side) {
+    int sizes[NUM_GROUPS];
+    groupSizes(material, sizes);
+
+    side = static_cast<int>(index % NUM_SIDES);
+    index /= NUM_SIDES;
+
+    // Radix of each group, then peel the ranks off from the last group
+    uint64_t radix[NUM_GROUPS];
+    int freeSquares = NUM_SQUARES;
+    for (int group = 0; group < NUM_GROUPS; ++group) {
+        radix[group] = choose(freeSquares, sizes[group]);
+        freeSquares -= sizes[group];
+    }
+    uint64_t ranks[NUM_GROUPS];
+    for (int group = NUM_GROUPS - 1; group >= 0; --group) {
+        ranks[group] = index % radix[group];
+        index /= radix[group];
+    }
+
+    uint32_t masks[NUM_GROUPS];
+    uint32_t occupied = 0;
+    for (int group = 0; group < NUM_GROUPS; ++group) {
+        masks[group] = unrankGroup(ranks[group], sizes[group], occupied);
+        occupied |= masks[group];
+    }
+
+    board = BitBoard();
+    board.pieces[0] = masks[0] | masks[2];
+    board.pieces[1] = masks[1] | masks[3];
+    board.dames = masks[2] | masks[3];
+}
+
+bool TablebaseIndex::isReachable(const BitBoard& board) {
+    return (board.pions(0) & promotionRow(0)) == 0 && (board.pions(1) & promotionRow(1)) == 0;
+}
+
+int Tablebase::open(const std::string& directory) {
+    namespace fs = std::filesystem;
+    std::error_code error;
+    int found = 0;
+
+    for (const auto& item : fs::directory_iterator(directory, error)) {
+        if (item.path().extension() != ".tb") continue;
+
+        MappedFile file;
+        if (!file.open(item.path().string()) || file.size() < sizeof(TablebaseHeader)) continue;
+
+        TablebaseHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) continue;
+
+        // A corrupt header mustn't alias another table's key or index past
+        // the end of the file, so check the counts before sizing them
+        Material material;
+        bool countsFit = true;
+        for (int side = 0; side < NUM_SIDES; ++side) {
+            material.pions[side] = header.pions[side];
+            material.dames[side] = header.dames[side];
+            if (header.pions[side] > MAX_MATERIAL_COUNT || header.dames[side] > MAX_MATERIAL_COUNT) {
+                countsFit = false;
+            }
+        }
+        if (!countsFit || material.total() > TablebaseGenerator::MAX_PIECES ||
+            item.path().filename() != material.fileName()) {
+            continue;
+        }
+        uint64_t size = TablebaseIndex::size(material);
+        if (size == 0 || header.entries != size || file.size() - sizeof(TablebaseHeader) != size) continue;
+
+        tables[material.key()] = std::move(file);
+        if (material.total() > largest) largest = material.total();
+        ++found;
+    }
+    return found;
+}
+
+void Tablebase::close() {
+    tables.clear();
+    largest = 0;
+}
+
+bool Tablebase::probe(const BitBoard& board, int side, Result& result) const {
+    if (popCount(board.occupied()) > largest) return false;
+
+    auto table = tables.find(Material::of(board).key());
+    if (table == tables.end()) return false;
+
+    uint8_t value = table->second.data()[sizeof(TablebaseHeader) + TablebaseIndex::index(board, side)];
+    result.distance = TablebaseValue::distance(value);
+    result.outcome = TablebaseValue::isWin(value) ? Outcome::Win
+                   : TablebaseValue::isLoss(value) ? Outcome::Loss
+                   : Outcome::Draw;
+    return true;
+}
+
+bool Tablebase::probe(const GameModel& model, Result& result) const {
+    if (model.getCurrentSide() == NO_SIDE) return false;
+    return probe(model.getBitBoard(), model.getCurrentSide(), result);
+}
@@ -0,0 +1,238 @@
+#include "TablebaseGenerator.h"
+#include "MoveList.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    // Positions expanded per pool task in the forward pass
+    constexpr uint64_t CHUNK_SIZE = 1 << 14;
+
+    constexpr int16_t NONE = -1;
+
+    // What the forward pass learns about one position
+    struct PositionInfo {
+        uint16_t remaining = 0;      // Successors not yet known to be won
+        int16_t longestWin = NONE;   // Longest win among successors resolved so far
+        int16_t quickestLoss = NONE; // Shortest loss among successors in other Materials
+        bool reachable = true;
+        bool hasMoves = false;
+    };
+}
+
+struct TablebaseGenerator::Chunk {
+    PositionInfo* info = nullptr;
+    std::vector<std::pair<uint32_t, uint32_t>> edges;   // (successor, predecessor) inside the Material
+};
+
+TablebaseGenerator::TablebaseGenerator(unsigned threads) {
+    if (threads != 1) {
+        pool = std::make_unique<ThreadPool>(threads);
+        if (pool->size() == 1) pool.reset();
+    }
+}
+
+TablebaseGenerator::~TablebaseGenerator() = default;
+
+std::vector<Material> TablebaseGenerator::materials(int maxPieces) {
+    std::vector<Material> result;
+    for (int p0 = 0; p0 < maxPieces; ++p0) {
+        for (int d0 = 0; p0 + d0 < maxPieces; ++d0) {
+            for (int p1 = 0; p0 + d0 + p1 <= maxPieces; ++p1) {
+                for (int d1 = 0; p0 + d0 + p1 + d1 <= maxPieces; ++d1) {
+                    Material material;
+                    material.pions[0] = p0;
+                    material.dames[0] = d0;
+                    material.pions[1] = p1;
+                    material.dames[1] = d1;
+                    if (material.pieces(0) > 0 && material.pieces(1) > 0) result.push_back(material);
+                }
+            }
+        }
+    }
+
+    std::stable_sort(result.begin(), result.end(), [](const Material& a, const Material& b) {
+        if (a.total() != b.total()) return a.total() < b.total();
+        return a.pions[0] + a.pions[1] < b.pions[0] + b.pions[1];
+    });
+    return result;
+}
+
+bool TablebaseGenerator::generate(int maxPieces, const std::string& directory) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    for (const auto& material : materials(maxPieces)) {
+        if (solve(material).empty()) return false;
+        if (!write(material, directory)) return false;
+    }
+    return true;
+}
+
+uint8_t TablebaseGenerator::lookup(const BitBoard& board, int side) const {
+    // A side with no pieces left has no move
+    if (board.pieces[side] == 0) return TablebaseValue::loss(0);
+    return solved.at(Material::of(board).key())[TablebaseIndex::index(board, side)];
+}
+
+void TablebaseGenerator::expand(const Material& material, Chunk& chunk, uint64_t begin, uint64_t end) const {
+    GameModel model;
+    MoveList moves;
+    BitBoard board;
+    int side;
+
+    for (uint64_t index = begin; index < end; ++index) {
+        PositionInfo& info = chunk.info[index];
+        TablebaseIndex::position(material, index, board, side);
+        if (!TablebaseIndex::isReachable(board)) {
+            info.reachable = false;
+            continue;
+        }
+
+        model.initializeFromBitBoard("Player1", "Player2", board, side);
+        model.generateMoves(moves);
+        info.hasMoves = !moves.empty();
+
+        for (const auto& entry : moves) {
+            GameModel::UndoInfo undo = model.makeMove(entry);
+            const BitBoard& child = model.getBitBoard();
+
+            if (Material::of(child) == material) {
+                chunk.edges.emplace_back(static_cast<uint32_t>(TablebaseIndex::index(child, 1 - side)),
+                                         static_cast<uint32_t>(index));
+                ++info.remaining;
+            } else {
+                uint8_t value = lookup(child, 1 - side);
+                int distance = TablebaseValue::distance(value);
+                if (TablebaseValue::isWin(value)) {
+                    info.longestWin = std::max<int16_t>(info.longestWin, static_cast<int16_t>(distance));
+                } else {
+                    // An exit that isn't won keeps the position from being lost
+                    ++info.remaining;
+                    if (TablebaseValue::isLoss(value) && (info.quickestLoss == NONE || distance < info.quickestLoss)) {
+                        info.quickestLoss = static_cast<int16_t>(distance);
+                    }
+                }
+            }
+            model.unmakeMove(undo);
+        }
+    }
+}
+
+const std::vector<uint8_t>& TablebaseGenerator::solve(const Material& material) {
+    static const std::vector<uint8_t> unsolved;
+    uint64_t size = TablebaseIndex::size(material);
+    if (size > MAX_MATERIAL_SIZE) return unsolved;
+    std::vector<PositionInfo> info(size);
+
+    // Forward pass: successor counts, exits to solved Materials, and the
+    // quiet-move edges inside this one
+    uint64_t chunkCount = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<Chunk> chunks(chunkCount);
+    if (pool) {
+        ThreadPool::TaskGroup group;
+        for (uint64_t i = 0; i < chunkCount; ++i) {
+            chunks[i].info = info.data();
+            pool->submit(group, [this, &material, &chunks, i, size]() {
+                expand(material, chunks[i], i * CHUNK_SIZE, std::min(size, (i + 1) * CHUNK_SIZE));
+            });
+        }
+        pool->wait(group);
+    } else {
+        for (uint64_t i = 0; i < chunkCount; ++i) {
+            chunks[i].info = info.data();
+            expand(material, chunks[i], i * CHUNK_SIZE, std::min(size, (i + 1) * CHUNK_SIZE));
+        }
+    }
+
+    // Predecessor lists in compressed rows
+    std::vector<uint64_t> offsets(size + 1, 0);
+    for (const auto& chunk : chunks) {
+        for (const auto& edge : chunk.edges) ++offsets[edge.first + 1];
+    }
+    for (uint64_t i = 0; i < size; ++i) offsets[i + 1] += offsets[i];
+    std::vector<uint32_t> predecessors(offsets[size]);
+    {
+        std::vector<uint64_t> next(offsets.begin(), offsets.end() - 1);
+        for (auto& chunk : chunks) {
+            for (const auto& edge : chunk.edges) predecessors[next[edge.first]++] = edge.second;
+            std::vector<std::pair<uint32_t, uint32_t>>().swap(chunk.edges);
+        }
+    }
+
+    // Backward pass: resolve positions in order of distance, one bucket of
+    // candidate wins and one of candidate losses per distance
+    std::vector<std::vector<uint32_t>> wins(1), losses(1);
+    auto push = [](std::vector<std::vector<uint32_t>>& buckets, size_t distance, uint64_t index) {
+        if (buckets.size() <= distance) buckets.resize(distance + 1);
+        buckets[distance].push_back(static_cast<uint32_t>(index));
+    };
+
+    for (uint64_t i = 0; i < size; ++i) {
+        const PositionInfo& position = info[i];
+        if (!position.reachable) continue;
+        if (!position.hasMoves) {
+            push(losses, 0, i);
+        } else if (position.quickestLoss != NONE) {
+            push(wins, position.quickestLoss + 1, i);
+        } else if (position.remaining == 0) {
+            push(losses, position.longestWin + 1, i);
+        }
+    }
+
+    std::vector<uint8_t> values(size, TablebaseValue::DRAW);
+    std::vector<bool> resolved(size, false);
+    for (size_t distance = 0; distance < std::max(wins.size(), losses.size()); ++distance) {
+        if (distance < losses.size()) {
+            for (size_t k = 0; k < losses[distance].size(); ++k) {
+                uint32_t index = losses[distance][k];
+                if (resolved[index]) continue;
+                resolved[index] = true;
+                values[index] = TablebaseValue::loss(static_cast<int>(distance));
+                for (uint64_t p = offsets[index]; p < offsets[index + 1]; ++p) {
+                    if (!resolved[predecessors[p]]) push(wins, distance + 1, predecessors[p]);
+                }
+            }
+            std::vector<uint32_t>().swap(losses[distance]);
+        }
+        if (distance < wins.size()) {
+            for (size_t k = 0; k < wins[distance].size(); ++k) {
+                uint32_t index = wins[distance][k];
+                if (resolved[index]) continue;
+                resolved[index] = true;
+                values[index] = TablebaseValue::win(static_cast<int>(distance));
+                for (uint64_t p = offsets[index]; p < offsets[index + 1]; ++p) {
+                    uint32_t predecessor = predecessors[p];
+                    if (resolved[predecessor]) continue;
+                    PositionInfo& parent = info[predecessor];
+                    parent.longestWin = std::max<int16_t>(parent.longestWin, static_cast<int16_t>(distance));
+                    if (--parent.remaining == 0) push(losses, parent.longestWin + 1, predecessor);
+                }
+            }
+            std::vector<uint32_t>().swap(wins[distance]);
+        }
+    }
+
+    return solved[material.key()] = std::move(values);
+}
+
+bool TablebaseGenerator::write(const Material& material, const std::string& directory) const {
+    auto table = solved.find(material.key());
+    if (table == solved.end()) return false;
+
+    TablebaseHeader header{};
+    std::copy(Tablebase::MAGIC, Tablebase::MAGIC + sizeof(Tablebase::MAGIC), header.magic);
+    header.version = Tablebase::VERSION;
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        header.pions[side] = static_cast<uint8_t>(material.pions[side]);
+        header.dames[side] = static_cast<uint8_t>(material.dames[side]);
+    }
+    header.entries = table->second.size();
+
+    std::string path = (std::filesystem::path(directory) / material.fileName()).string();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table->second.data()), static_cast<std::streamsize>(table->second.size()));
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,139 @@
+#include "ThreadPool.h"
+
+namespace {
+    // Identifies the pool and worker slot of the running thread
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local int currentIndex = -1;
+
+    // Tasks run inside wait() nest on the waiting thread's stack. Taking a
+    // child of the awaited group only goes as deep as the task tree, but a
+    // stolen task is unrelated work, so stealing stops past this depth.
+    constexpr int MAX_STEAL_NESTING = 8;
+    thread_local int stealNesting = 0;
+}
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+    if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+
+    for (unsigned i = 0; i <= threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, static_cast<int>(i));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping.store(true);
+    }
+    wakeUp.notify_all();
+    for (auto& worker : workers) worker.join();
+}
+
+int ThreadPool::currentWorker() const {
+    return currentPool == this ? currentIndex : -1;
+}
+
+void ThreadPool::submit(TaskGroup& group, std::function<void()> task) {
+    group.pending.fetch_add(1, std::memory_order_relaxed);
+
+    int self = currentWorker();
+    WorkQueue& queue = self >= 0 ? *queues[self] : *queues.back();
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(Task{std::move(task), &group});
+    }
+    queuedTasks.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders this wake-up after a sleeper's predicate check
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    wakeUp.notify_one();
+}
+
+void ThreadPool::wait(TaskGroup& group) {
+    int self = currentWorker();
+    while (!group.done()) {
+        Task task;
+        if (popGroupTask(self, group, task)) {
+            runTask(task);
+        } else if (stealNesting < MAX_STEAL_NESTING && stealTask(self, task)) {
+            ++stealNesting;
+            runTask(task);
+            --stealNesting;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool ThreadPool::popGroupTask(int self, TaskGroup& group, Task& task) {
+    WorkQueue& queue = self >= 0 ? *queues[self] : *queues.back();
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty() || queue.tasks.back().group != &group) return false;
+
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool ThreadPool::popTask(int self, Task& task) {
+    if (self >= 0) {
+        WorkQueue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return stealTask(self, task);
+}
+
+bool ThreadPool::stealTask(int self, Task& task) {
+    // Try the injection queue first, then the other workers in turn
+    int count = static_cast<int>(queues.size());
+    int start = count - 1;
+    for (int offset = 0; offset < count; ++offset) {
+        int index = (start + offset + (self >= 0 ? self : 0)) % count;
+        if (index == self) continue;
+
+        WorkQueue& victim = *queues[index];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::runTask(Task& task) {
+    task.run();
+    task.group->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void ThreadPool::workerLoop(int index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (true) {
+        Task task;
+        if (popTask(index, task)) {
+            runTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this]() {
+            return stopping.load() || queuedTasks.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping.load()) return;
+    }
+}
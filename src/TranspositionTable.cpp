@@ -0,0 +1,158 @@
+#include "TranspositionTable.h"
+#include <algorithm>
+#include <climits>
+
+TranspositionTable::TranspositionTable(size_t sizeMB) {
+    resize(sizeMB);
+}
+
+void TranspositionTable::resize(size_t sizeMB) {
+    megabytes = std::max<size_t>(sizeMB, 1);
+
+    // Largest power of two bucket count that fits, so indexing is a mask
+    size_t available = (megabytes << 20) / sizeof(Bucket);
+    bucketCount = 1;
+    while (bucketCount * 2 <= available) bucketCount *= 2;
+
+    buckets.reset(new Bucket[bucketCount]);
+    clear();
+}
+
+void TranspositionTable::clear() {
+    for (size_t i = 0; i < bucketCount; ++i) {
+        for (auto& slot : buckets[i].slots) {
+            slot.data.store(0, std::memory_order_relaxed);
+            slot.check.store(0, std::memory_order_relaxed);
+        }
+    }
+    age.store(0, std::memory_order_relaxed);
+    resetStats();
+}
+
+void TranspositionTable::newSearch() {
+    age.store((age.load(std::memory_order_relaxed) + 1) & MAX_AGE, std::memory_order_relaxed);
+}
+
+uint64_t TranspositionTable::pack(CompactMove move, int score, int depth, Bound bound, int age) {
+    return static_cast<uint64_t>(move.raw()) |
+           (static_cast<uint64_t>(static_cast<uint16_t>(static_cast<int16_t>(score))) << 32) |
+           (static_cast<uint64_t>(depth) << 48) |
+           (static_cast<uint64_t>(bound) << 56) |
+           (static_cast<uint64_t>(age) << 58);
+}
+
+TranspositionTable::Entry TranspositionTable::unpack(uint64_t data) {
+    Entry entry;
+    entry.bestMove = CompactMove::fromRaw(static_cast<uint32_t>(data));
+    entry.score = static_cast<int16_t>(static_cast<uint16_t>(data >> 32));
+    entry.depth = depthOf(data);
+    entry.bound = static_cast<Bound>((data >> 56) & 3u);
+    return entry;
+}
+
+bool TranspositionTable::probe(uint64_t key, Entry& entry) const {
+    Bucket& bucket = bucketFor(key);
+    int currentAge = age.load(std::memory_order_relaxed);
+
+    for (auto& slot : bucket.slots) {
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        uint64_t check = slot.check.load(std::memory_order_relaxed);
+        if ((check ^ data) != key || ((data >> 56) & 3u) == 0) continue;
+
+        // Entries still in use by this search shouldn't age out
+        if (ageOf(data) != currentAge) {
+            uint64_t refreshed = (data & ~(static_cast<uint64_t>(MAX_AGE) << 58)) |
+                                 (static_cast<uint64_t>(currentAge) << 58);
+            slot.data.store(refreshed, std::memory_order_relaxed);
+            slot.check.store(key ^ refreshed, std::memory_order_relaxed);
+        }
+
+        entry = unpack(data);
+        stripeFor(key).hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    stripeFor(key).misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void TranspositionTable::store(uint64_t key, int depth, int score, Bound bound, CompactMove bestMove) {
+    Bucket& bucket = bucketFor(key);
+    int currentAge = age.load(std::memory_order_relaxed);
+
+    Slot* target = nullptr;
+    bool evicts = false;
+    int lowestValue = INT_MAX;
+
+    for (auto& slot : bucket.slots) {
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        uint64_t check = slot.check.load(std::memory_order_relaxed);
+        bool used = ((data >> 56) & 3u) != 0;
+
+        if (used && (check ^ data) == key) {
+            // Same position: keep its best move if this store has none
+            if (bestMove.isNull()) bestMove = unpack(data).bestMove;
+            target = &slot;
+            evicts = false;
+            break;
+        }
+
+        // Free slots first, then the shallowest entry after an age penalty
+        int value = used ? depthOf(data) - 8 * ((currentAge - ageOf(data)) & MAX_AGE) : INT_MIN;
+        if (value < lowestValue) {
+            lowestValue = value;
+            target = &slot;
+            evicts = used;
+        }
+    }
+
+    uint64_t data = pack(bestMove, score, std::min(std::max(depth, 0), MAX_DEPTH), bound, currentAge);
+    target->data.store(data, std::memory_order_relaxed);
+    target->check.store(key ^ data, std::memory_order_relaxed);
+
+    StatStripe& stripe = stripeFor(key);
+    stripe.stores.fetch_add(1, std::memory_order_relaxed);
+    if (evicts) stripe.collisions.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TranspositionTable::prefetch(uint64_t key) const {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(&bucketFor(key));
+#else
+    (void)key;
+#endif
+}
+
+TranspositionTable::Stats TranspositionTable::getStats() const {
+    Stats total;
+    for (const auto& stripe : stats) {
+        total.hits += stripe.hits.load(std::memory_order_relaxed);
+        total.misses += stripe.misses.load(std::memory_order_relaxed);
+        total.collisions += stripe.collisions.load(std::memory_order_relaxed);
+        total.stores += stripe.stores.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void TranspositionTable::resetStats() {
+    for (auto& stripe : stats) {
+        stripe.hits.store(0, std::memory_order_relaxed);
+        stripe.misses.store(0, std::memory_order_relaxed);
+        stripe.collisions.store(0, std::memory_order_relaxed);
+        stripe.stores.store(0, std::memory_order_relaxed);
+    }
+}
+
+int TranspositionTable::hashfull() const {
+    int currentAge = age.load(std::memory_order_relaxed);
+    int used = 0;
+    int sampled = 0;
+    for (size_t i = 0; i < bucketCount && sampled < 1000; ++i) {
+        for (const auto& slot : buckets[i].slots) {
+            uint64_t data = slot.data.load(std::memory_order_relaxed);
+            if (((data >> 56) & 3u) != 0 && ageOf(data) == currentAge) ++used;
+            ++sampled;
+        }
+    }
+    return sampled ? used * 1000 / sampled : 0;
+}
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BatchAnalyzer.h"
+
+namespace {
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --in FILE          Positions to analyze, one notation per line, '-' for stdin\n"
+                  << "                     (default stdin)\n"
+                  << "  --out FILE         Write one line per position to FILE, '-' for stdout (default stdout)\n"
+                  << "  --threads N        Analyze on N threads, 0 for all hardware threads (default 0)\n"
+                  << "  --queue N          Positions in flight between input and output (default 4096)\n"
+                  << "  --depth N          Also search each position to depth N, 0 for no search (default 0)\n"
+                  << "  --nodes N          Node limit of each search (default: none)\n"
+                  << "  --hash MB          Hash table of each worker's search (default 1)\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    AnalysisConfig config;
+    std::string input = "-";
+    std::string output = "-";
+    int depth = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--in" && hasValue) {
+            input = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            output = argv[++i];
+        } else if (arg == "--threads" && hasValue) {
+            config.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else if (arg == "--queue" && hasValue) {
+            config.queueSize = static_cast<size_t>(std::atoll(argv[++i]));
+        } else if (arg == "--depth" && hasValue) {
+            depth = std::atoi(argv[++i]);
+        } else if (arg == "--nodes" && hasValue) {
+            config.limits.maxNodes = static_cast<uint64_t>(std::atoll(argv[++i]));
+        } else if (arg == "--hash" && hasValue) {
+            config.hashMB = static_cast<size_t>(std::atoll(argv[++i]));
+        } else {
+            printUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+    config.search = depth > 0;
+    config.limits.maxDepth = depth;
+
+    std::ios::sync_with_stdio(false);
+    std::ifstream inFile;
+    std::istream* in = &std::cin;
+    if (input != "-") {
+        inFile.open(input);
+        if (!inFile) {
+            std::cerr << "Cannot read " << input << std::endl;
+            return 1;
+        }
+        in = &inFile;
+    }
+
+    // Results stream through one large buffer, never flushed per line
+    std::ofstream outFile;
+    std::ostream* out = &std::cout;
+    std::vector<char> buffer(1 << 20);
+    if (output != "-") {
+        outFile.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        outFile.open(output, std::ios::trunc);
+        if (!outFile) {
+            std::cerr << "Cannot write " << output << std::endl;
+            return 1;
+        }
+        out = &outFile;
+    }
+
+    BatchAnalyzer analyzer(config);
+    auto start = std::chrono::steady_clock::now();
+    BatchAnalyzer::Summary summary = analyzer.run(
+        [&](std::string& line) { return static_cast<bool>(std::getline(*in, line)); },
+        [&](const PositionAnalysis& result) { BatchAnalyzer::write(*out, result); });
+    out->flush();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // The summary goes to stderr so stdout can carry the results
+    std::cerr << std::fixed << std::setprecision(2)
+              << summary.positions << " positions in " << seconds << " s ("
+              << std::setprecision(0) << (seconds > 0 ? summary.positions / seconds : 0.0) << " positions/s), "
+              << summary.gameOver << " game over, " << summary.invalid << " invalid" << std::endl;
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "GameRecordFile.h"
+#include "MoveList.h"
+#include "OpeningBook.h"
+#include "SearchEngine.h"
+
+namespace {
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --games N          Self-play games to record (default 200)\n"
+                  << "  --plies N          Plies of each game kept in the book (default 16)\n"
+                  << "  --random N         Opening plies played at random for variety (default 4)\n"
+                  << "  --depth N          Search depth of the other moves (default 4)\n"
+                  << "  --max-moves N      Games still running after N plies are draws (default 200)\n"
+                  << "  --min-plays N      Keep moves played at least N times (default 2)\n"
+                  << "  --seed N           Random seed (default 1)\n"
+                  << "  --records FILE     Build from the games of a record file instead of playing\n"
+                  << "  --out FILE         Book file to write (default opening.book)\n";
+    }
+
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int games = 200;
+    int plies = 16;
+    int randomPlies = 4;
+    int depth = 4;
+    int maxMoves = 200;
+    uint32_t minPlays = 2;
+    uint64_t seed = 1;
+    std::string path = "opening.book";
+    std::string records;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--games" && hasValue) {
+            games = std::atoi(argv[++i]);
+        } else if (arg == "--plies" && hasValue) {
+            plies = std::atoi(argv[++i]);
+        } else if (arg == "--random" && hasValue) {
+            randomPlies = std::atoi(argv[++i]);
+        } else if (arg == "--depth" && hasValue) {
+            depth = std::atoi(argv[++i]);
+        } else if (arg == "--max-moves" && hasValue) {
+            maxMoves = std::atoi(argv[++i]);
+        } else if (arg == "--min-plays" && hasValue) {
+            minPlays = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            seed = static_cast<uint64_t>(std::atoll(argv[++i]));
+        } else if (arg == "--out" && hasValue) {
+            path = argv[++i];
+        } else if (arg == "--records" && hasValue) {
+            records = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    GameModel start;
+    start.initializeStandardGame("Player1", "Player2");
+
+    OpeningBookBuilder builder(plies);
+    SearchEngine engine(16, 1);
+    SearchLimits limits;
+    limits.maxDepth = depth;
+    std::mt19937_64 random(seed);
+
+    auto begin = std::chrono::steady_clock::now();
+    int results[3] = {0, 0, 0};   // Player1 wins, Player2 wins, draws
+    if (!records.empty()) {
+        GameRecordReader reader;
+        if (!reader.open(records)) {
+            std::cerr << "Cannot read record file " << records << std::endl;
+            return 1;
+        }
+        games = 0;
+        RecordedGame game;
+        GameModel recordedStart;
+        while (reader.next(game)) {
+            game.setUp(recordedStart);
+            builder.addGame(recordedStart, game.moves, game.winner);
+            ++results[game.winner == NO_SIDE ? 2 : game.winner];
+            ++games;
+        }
+        if (reader.failed()) std::cerr << "Stopped at malformed data in " << records << std::endl;
+    }
+
+    for (int game = 0; records.empty() && game < games; ++game) {
+        GameModel model(start);
+        std::vector<Move> moves;
+        int winner = NO_SIDE;
+
+        for (int ply = 0; ply < maxMoves; ++ply) {
+            MoveList legal;
+            model.generateMoves(legal);
+            if (legal.empty()) {
+                winner = 1 - model.getCurrentSide();
+                break;
+            }
+
+            Move move;
+            if (ply < randomPlies) {
+                move = model.toMove(legal[static_cast<int>(random() % legal.size())]);
+            } else {
+                move = engine.search(model, limits).bestMove;
+            }
+            moves.push_back(move);
+            model.makeMove(model.encodeMove(move));
+        }
+
+        builder.addGame(start, moves, winner);
+        ++results[winner == NO_SIDE ? 2 : winner];
+    }
+
+    if (!builder.write(path, minPlays)) {
+        std::cerr << "Cannot write " << path << std::endl;
+        return 1;
+    }
+
+    OpeningBook book;
+    book.open(path);
+    std::cout << std::fixed << std::setprecision(2)
+              << games << " games (" << results[0] << " Player1 wins, " << results[1] << " Player2 wins, "
+              << results[2] << " draws) in " << secondsSince(begin) << " s\n"
+              << book.size() << " of " << builder.size() << " moves written to " << path << std::endl;
+    return 0;
+}
@@ -5,30 +5,43 @@
 #include <algorithm>
 #include "Board.h"
 #include "GameModel.h"
+#include "OpeningBook.h"
 #include "Piece.h"
+#include "SearchEngine.h"
 
 int main(int argc, char* argv[]) {
     Board board;
     board.initialize("Player1", "Player2");
+    SearchEngine engine;
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    // Book moves are played without searching; see the bookgen tool
+    OpeningBook book;
+    if (book.open(argc > 1 ? argv[1] : "opening.book")) {
+        engine.setOpeningBook(&book);
+        std::cout << "Opening book: " << book.size() << " entries" << std::endl;
+    }
     int step = 1;
     while (true) {
         std::cout << "\nStep " << step << ": Player " << board.getCurrentPlayer() << "'s turn" << std::endl;
         board.display();
-        auto allMoves = board.getAllValidMoves();
-        if (allMoves.empty()) {
-            std::cout << "Game over! Winner: " << (board.getCurrentPlayer().empty() ? "None" : board.getCurrentPlayer()) << std::endl;
+        if (board.getModel()->isGameOver()) {
+            std::cout << "Game over! Winner: " << board.getModel()->getWinner() << std::endl;
             break;
         }
-        // Pick the first piece with valid moves
-        auto it = allMoves.begin();
-        const Position& pos = it->first;
-        const std::vector<Move>& moves = it->second;
-        if (moves.empty()) {
-            std::cout << "No valid moves for selected piece. Skipping..." << std::endl;
+        // Let the search engine pick the move
+        SearchResult result = engine.search(*board.getModel(), limits);
+        if (!result.hasMove()) {
+            std::cout << "No valid moves found. Skipping..." << std::endl;
             break;
         }
-        const Move& move = moves[0];
-        std::cout << "Executing move from (" << move.from.x << "," << move.from.y << ") to (" << move.path.back().x << "," << move.path.back().y << ")" << std::endl;
+        const Move& move = result.bestMove;
+        std::cout << "Executing move from (" << move.from.x << "," << move.from.y << ") to (" << move.path.back().x << "," << move.path.back().y << ")";
+        if (result.fromBook) {
+            std::cout << " [book]" << std::endl;
+        } else {
+            std::cout << " [score " << result.score << ", depth " << result.depth << "]" << std::endl;
+        }
         board.executeMove(move);
         step++;
         // Optional: add a pause or limit steps for demo
@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "GameModel.h"
+#include "Perft.h"
+
+namespace {
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --depth N          Count leaves to depth N (default 7)\n"
+                  << "  --divide           Print the leaf count below each root move\n"
+                  << "  --hash MB          Cache subtree counts in a hash table of MB megabytes\n"
+                  << "  --threads N        Count on N threads, 0 for all hardware threads (default 0)\n"
+                  << "  --board POSITION   Start from a custom position instead of the standard one,\n"
+                  << "                     in position notation (\"1:xxxxxxxx................oooooooo\")\n"
+                  << "                     or as its 32 squares alone: '.' empty, 'x'/'X' Player1\n"
+                  << "                     Pion/Dame, 'o'/'O' Player2 Pion/Dame\n"
+                  << "  --side 1|2         Player to move when --board gives the squares alone (default 1)\n";
+    }
+
+    std::string describe(const Move& move) {
+        std::string text = "(" + std::to_string(move.from.x) + "," + std::to_string(move.from.y) + ")";
+        for (const auto& pos : move.path) {
+            text += move.isCapture() ? " x " : " -> ";
+            text += "(" + std::to_string(pos.x) + "," + std::to_string(pos.y) + ")";
+        }
+        return text;
+    }
+
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int depth = 7;
+    bool divide = false;
+    size_t hashMB = 0;
+    unsigned threads = 0;
+    std::string board;
+    int side = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--depth" && hasValue) {
+            depth = std::atoi(argv[++i]);
+        } else if (arg == "--divide") {
+            divide = true;
+        } else if (arg == "--hash" && hasValue) {
+            hashMB = static_cast<size_t>(std::atoll(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else if (arg == "--board" && hasValue) {
+            board = argv[++i];
+        } else if (arg == "--side" && hasValue) {
+            side = std::atoi(argv[++i]);
+        } else {
+            printUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    GameModel model;
+    if (board.empty()) {
+        model.initializeStandardGame("Player1", "Player2");
+    } else {
+        if (board.size() == NUM_SQUARES) board = (side == 2 ? "2:" : "1:") + board;
+        if (!model.fromNotation(board)) {
+            std::cerr << "Invalid --board value: expected a position like \"1:xxxxxxxx................oooooooo\""
+                      << std::endl;
+            return 1;
+        }
+    }
+
+#if !defined(__OPTIMIZE__) && (defined(__GNUC__) || defined(__clang__))
+    std::cout << "warning: unoptimized build, timings are not representative" << std::endl;
+#endif
+
+    Perft perft(hashMB, threads);
+    std::cout << std::fixed;
+    std::cout << "threads: " << perft.threadCount() << std::endl;
+
+    if (divide) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t total = 0;
+        for (const auto& line : perft.divide(model, depth)) {
+            std::cout << describe(line.move) << ": " << line.nodes << std::endl;
+            total += line.nodes;
+        }
+        double seconds = secondsSince(start);
+        std::cout << "\nTotal: " << total << " nodes in " << std::setprecision(3) << seconds << " s ("
+                  << std::setprecision(0) << (seconds > 0 ? total / seconds : 0.0) << " nps)" << std::endl;
+        return 0;
+    }
+
+    for (int d = 1; d <= depth; ++d) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t nodes = perft.count(model, d);
+        double seconds = secondsSince(start);
+        std::cout << "perft " << std::setw(2) << d << ": " << std::setw(14) << nodes << " nodes  "
+                  << std::setprecision(3) << std::setw(9) << seconds << " s  "
+                  << std::setprecision(0) << std::setw(12) << (seconds > 0 ? nodes / seconds : 0.0)
+                  << " nps" << std::endl;
+    }
+    return 0;
+}
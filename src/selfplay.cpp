@@ -0,0 +1,128 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "GameRecordFile.h"
+#include "SelfPlay.h"
+
+namespace {
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --games N          Games to play (default 1000)\n"
+                  << "  --threads N        Play on N threads, 0 for all hardware threads (default 0)\n"
+                  << "  --seed N           Random seed; equal seeds give equal games (default 1)\n"
+                  << "  --max-plies N      Games still running after N plies are draws (default 300)\n"
+                  << "  --p1 POLICY        Player1 policy: random, first or search (default random)\n"
+                  << "  --p2 POLICY        Player2 policy (default random)\n"
+                  << "  --depth N          Search depth of the search policy (default 2)\n"
+                  << "  --out FILE         Write one line per game to FILE, '-' for stdout (default: none)\n"
+                  << "  --format FORMAT    text, or binary to append to a game record file (default text)\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    SelfPlayConfig config;
+    std::string policies[NUM_SIDES] = {"random", "random"};
+    SearchLimits limits;
+    limits.maxDepth = 2;
+    std::string output;
+    std::string format = "text";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--games" && hasValue) {
+            config.games = static_cast<uint64_t>(std::atoll(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            config.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            config.seed = static_cast<uint64_t>(std::atoll(argv[++i]));
+        } else if (arg == "--max-plies" && hasValue) {
+            config.maxPlies = std::atoi(argv[++i]);
+        } else if (arg == "--p1" && hasValue) {
+            policies[0] = argv[++i];
+        } else if (arg == "--p2" && hasValue) {
+            policies[1] = argv[++i];
+        } else if (arg == "--depth" && hasValue) {
+            limits.maxDepth = std::atoi(argv[++i]);
+        } else if (arg == "--out" && hasValue) {
+            output = argv[++i];
+        } else if (arg == "--format" && hasValue) {
+            format = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    PolicyFactory factories[NUM_SIDES];
+    for (int side = 0; side < NUM_SIDES; ++side) {
+        factories[side] = makePolicyFactory(policies[side], limits);
+        if (!factories[side]) {
+            std::cerr << "Unknown policy: " << policies[side] << std::endl;
+            return 1;
+        }
+    }
+
+    bool binary = format == "binary";
+    if (!binary && format != "text") {
+        std::cerr << "Unknown format: " << format << std::endl;
+        return 1;
+    }
+    GameRecordWriter writer;
+    if (binary && (output.empty() || output == "-")) {
+        std::cerr << "Binary records need --out FILE" << std::endl;
+        return 1;
+    }
+    if (binary && !writer.open(output)) {
+        std::cerr << "Cannot write record file " << output << std::endl;
+        return 1;
+    }
+
+    // Records stream through one large buffer, never flushed per game
+    std::ofstream file;
+    std::ostream* out = nullptr;
+    std::vector<char> buffer(1 << 20);
+    if (binary) {
+        // Written below through the record writer
+    } else if (output == "-") {
+        std::ios::sync_with_stdio(false);
+        out = &std::cout;
+    } else if (!output.empty()) {
+        file.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        file.open(output, std::ios::trunc);
+        if (!file) {
+            std::cerr << "Cannot write " << output << std::endl;
+            return 1;
+        }
+        out = &file;
+    }
+
+    SelfPlayRunner runner(factories[0], factories[1]);
+    GameModel standard;
+    standard.initializeStandardGame("Player1", "Player2");
+    auto start = std::chrono::steady_clock::now();
+    SelfPlayRunner::Summary summary = runner.run(config, [&](const GameRecord& record) {
+        if (out) SelfPlayRunner::write(*out, record);
+        if (binary) {
+            writer.beginGame(standard);
+            for (const auto& move : record.moves) writer.addMove(move);
+            writer.endGame(record.winner);
+        }
+    });
+    if (out) out->flush();
+    writer.close();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // The summary goes to stderr so stdout can carry the records
+    std::cerr << std::fixed << std::setprecision(2)
+              << summary.games << " games in " << seconds << " s ("
+              << (seconds > 0 ? summary.games / seconds : 0.0) << " games/s, "
+              << std::setprecision(0) << (seconds > 0 ? summary.plies / seconds : 0.0) << " plies/s)\n"
+              << "Player1 wins " << summary.wins[0] << ", Player2 wins " << summary.wins[1]
+              << ", draws " << summary.draws << std::endl;
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "TablebaseGenerator.h"
+
+namespace {
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --pieces K         Solve every ending with up to K pieces, 2 to 7 (default 4)\n"
+                  << "  --out DIR          Directory for the table files (default tablebases)\n"
+                  << "  --threads N        Expand positions on N threads, 0 for all hardware threads (default 0)\n";
+    }
+
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int pieces = 4;
+    std::string directory = "tablebases";
+    unsigned threads = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--pieces" && hasValue) {
+            pieces = std::atoi(argv[++i]);
+        } else if (arg == "--out" && hasValue) {
+            directory = argv[++i];
+        } else if (arg == "--threads" && hasValue) {
+            threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else {
+            printUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    if (pieces < 2 || pieces > TablebaseGenerator::MAX_PIECES) {
+        std::cerr << "Invalid --pieces value: expected 2 to " << TablebaseGenerator::MAX_PIECES << std::endl;
+        return 1;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Cannot create " << directory << ": " << error.message() << std::endl;
+        return 1;
+    }
+
+    TablebaseGenerator generator(threads);
+    auto total = std::chrono::steady_clock::now();
+    uint64_t positions = 0;
+    std::cout << std::fixed;
+
+    for (const auto& material : TablebaseGenerator::materials(pieces)) {
+        auto start = std::chrono::steady_clock::now();
+        const std::vector<uint8_t>& values = generator.solve(material);
+        if (values.empty()) {
+            std::cerr << "Cannot solve " << material.fileName() << ": too many positions" << std::endl;
+            return 1;
+        }
+
+        uint64_t wins = 0, losses = 0, draws = 0;
+        int longest = 0;
+        BitBoard board;
+        int side;
+        for (uint64_t index = 0; index < values.size(); ++index) {
+            uint8_t value = values[index];
+            TablebaseIndex::position(material, index, board, side);
+            if (!TablebaseIndex::isReachable(board)) continue;
+
+            if (TablebaseValue::isWin(value)) ++wins;
+            else if (TablebaseValue::isLoss(value)) ++losses;
+            else ++draws;
+            if (value != TablebaseValue::DRAW && TablebaseValue::distance(value) > longest) {
+                longest = TablebaseValue::distance(value);
+            }
+        }
+
+        if (!generator.write(material, directory)) {
+            std::cerr << "Cannot write " << material.fileName() << " to " << directory << std::endl;
+            return 1;
+        }
+
+        positions += values.size();
+        std::cout << std::left << std::setw(14) << material.fileName() << std::right
+                  << std::setw(12) << values.size() << " positions  "
+                  << std::setw(11) << wins << " won  "
+                  << std::setw(11) << losses << " lost  "
+                  << std::setw(11) << draws << " drawn  longest " << std::setw(3) << longest << "  "
+                  << std::setprecision(2) << secondsSince(start) << " s" << std::endl;
+    }
+
+    std::cout << "\nTotal: " << positions << " positions in " << std::setprecision(2)
+              << secondsSince(total) << " s" << std::endl;
+    return 0;
+}
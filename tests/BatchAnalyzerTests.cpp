@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <sstream>
+#include "BatchAnalyzer.h"
+#include "TestPositions.h"
+
+// BatchAnalyzer Tests
+// Tests single-position analysis and the ordered, bounded multi-threaded pipeline
+class BatchAnalyzerTests : public ::testing::Test {
+protected:
+    GameModel model;
+
+    // Positions along a few deterministic games
+    static std::vector<std::string> playedPositions(size_t count) {
+        std::vector<std::string> positions;
+        GameModel game;
+        for (int seed = 0; positions.size() < count; ++seed) {
+            game.initializeStandardGame("Player1", "Player2");
+            int plies = static_cast<int>(count - positions.size()) - 1;
+            walkGame(game, plies, seed, [&](const MoveList&, int) { positions.push_back(game.toNotation()); });
+        }
+        return positions;
+    }
+
+    static std::string runToText(const std::vector<std::string>& lines, const AnalysisConfig& config,
+                                 BatchAnalyzer::Summary* summary = nullptr) {
+        size_t next = 0;
+        std::ostringstream out;
+        BatchAnalyzer analyzer(config);
+        BatchAnalyzer::Summary result = analyzer.run(
+            [&](std::string& line) {
+                if (next == lines.size()) return false;
+                line = lines[next++];
+                return true;
+            },
+            [&](const PositionAnalysis& analysis) { BatchAnalyzer::write(out, analysis); });
+        if (summary) *summary = result;
+        return out.str();
+    }
+};
+
+TEST_F(BatchAnalyzerTests, AnalyzesStandardStart) {
+    PositionAnalysis result;
+    BatchAnalyzer::analyze("1:xxxxxxxx................oooooooo", model, nullptr, SearchLimits(), result);
+    EXPECT_TRUE(result.valid);
+    EXPECT_FALSE(result.gameOver);
+    EXPECT_EQ(result.winner, NO_SIDE);
+    EXPECT_FALSE(result.searched);
+
+    MoveList legal;
+    model.generateMoves(legal);
+    ASSERT_EQ(result.moves.size(), 7u);
+    for (int i = 0; i < legal.size(); ++i) EXPECT_EQ(result.moves[i], model.encodeMove(legal[i]));
+}
+
+TEST_F(BatchAnalyzerTests, DetectsGameOver) {
+    PositionAnalysis result;
+    BatchAnalyzer::analyze("1:........................oooooooo", model, nullptr, SearchLimits(), result);
+    EXPECT_TRUE(result.valid);
+    EXPECT_TRUE(result.gameOver);
+    EXPECT_EQ(result.winner, 1);
+    EXPECT_TRUE(result.moves.empty());
+
+    std::ostringstream out;
+    BatchAnalyzer::write(out, result);
+    EXPECT_EQ(out.str(), "0 0-1 0\n");
+}
+
+TEST_F(BatchAnalyzerTests, FlagsInvalidLines) {
+    PositionAnalysis result;
+    BatchAnalyzer::analyze("not a position", model, nullptr, SearchLimits(), result);
+    EXPECT_FALSE(result.valid);
+
+    // Windows line endings are fine
+    BatchAnalyzer::analyze("1:xxxxxxxx................oooooooo\r", model, nullptr, SearchLimits(), result);
+    EXPECT_TRUE(result.valid);
+
+    AnalysisConfig config;
+    config.threads = 2;
+    BatchAnalyzer::Summary summary;
+    std::string text = runToText({"", "1:xxxxxxxx................oooooooo", "2:"}, config, &summary);
+    EXPECT_EQ(summary.positions, 3u);
+    EXPECT_EQ(summary.invalid, 2u);
+    EXPECT_EQ(text.substr(0, 10), "0 invalid\n");
+    EXPECT_EQ(text.substr(text.size() - 10), "2 invalid\n");
+}
+
+TEST_F(BatchAnalyzerTests, SearchFindsCapture) {
+    std::string position = "1:.........x...o.................o";
+
+    SearchEngine engine(1, 1);
+    SearchLimits limits;
+    limits.maxDepth = 3;
+    PositionAnalysis result;
+    BatchAnalyzer::analyze(position, model, &engine, limits, result);
+    ASSERT_TRUE(result.searched);
+    EXPECT_TRUE(result.bestMove.isCapture());
+    EXPECT_EQ(result.depth, 3);
+
+    std::ostringstream out;
+    BatchAnalyzer::write(out, result);
+    EXPECT_NE(out.str().find(" best "), std::string::npos);
+}
+
+TEST_F(BatchAnalyzerTests, OutputKeepsInputOrderOnAnyThreadCount) {
+    std::vector<std::string> positions = playedPositions(3000);
+    AnalysisConfig config;
+    config.threads = 1;
+    std::string expected = runToText(positions, config);
+
+    config.threads = 4;
+    config.queueSize = 7;
+    BatchAnalyzer::Summary summary;
+    EXPECT_EQ(runToText(positions, config, &summary), expected);
+    EXPECT_EQ(summary.positions, positions.size());
+    EXPECT_EQ(summary.invalid, 0u);
+    EXPECT_GT(summary.gameOver, 0u);
+}
+
+TEST_F(BatchAnalyzerTests, SearchResultsDontDependOnThreads) {
+    std::vector<std::string> positions = playedPositions(200);
+    AnalysisConfig config;
+    config.search = true;
+    config.limits.maxDepth = 3;
+    config.threads = 1;
+    std::string expected = runToText(positions, config);
+
+    config.threads = 3;
+    config.queueSize = 16;
+    EXPECT_EQ(runToText(positions, config), expected);
+}
+
+TEST_F(BatchAnalyzerTests, BoundsPositionsInFlight) {
+    std::vector<std::string> positions = playedPositions(2000);
+    AnalysisConfig config;
+    config.threads = 4;
+    config.queueSize = 5;
+
+    std::atomic<uint64_t> read{0};
+    uint64_t delivered = 0;
+    bool withinBound = true;
+    BatchAnalyzer analyzer(config);
+    analyzer.run(
+        [&](std::string& line) {
+            uint64_t next = read.load();
+            if (next == positions.size()) return false;
+            line = positions[next];
+            read.store(next + 1);
+            return true;
+        },
+        [&](const PositionAnalysis& result) {
+            if (result.index != delivered || read.load() > delivered + config.queueSize) withinBound = false;
+            ++delivered;
+        });
+    EXPECT_TRUE(withinBound);
+    EXPECT_EQ(delivered, positions.size());
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "BatchEvaluation.h"
+#include "Evaluation.h"
+#include "GameModel.h"
+
+// BatchEvaluation Tests
+// Tests that every evaluation kernel agrees with Evaluation::evaluate
+class BatchEvaluationTests : public ::testing::Test {
+protected:
+    std::vector<GameModel> positions;
+    PositionBatch batch;
+    
+    // Positions from reproducible playouts, with the side to move varying
+    void SetUp() override {
+        uint32_t state = 12345;
+        for (int game = 0; game < 40 && positions.size() < 1003; ++game) {
+            GameModel model;
+            model.initializeStandardGame("Player1", "Player2");
+            for (int ply = 0; ply < 80 && positions.size() < 1003; ++ply) {
+                MoveList moves;
+                model.generateMoves(moves);
+                if (moves.empty()) break;
+                state = state * 1103515245u + 12345u;
+                model.makeMove(moves[(state >> 16) % moves.size()]);
+                positions.push_back(model);
+                batch.add(model);
+            }
+        }
+    }
+    
+    void expectKernelMatches(BatchEvaluation::Kernel kernel) {
+        std::vector<int32_t> scores(batch.size(), 0x7FFFFFFF);
+        BatchEvaluation::evaluate(batch, scores.data(), kernel);
+        for (size_t i = 0; i < positions.size(); ++i) {
+            ASSERT_EQ(scores[i], Evaluation::evaluate(positions[i]))
+                << BatchEvaluation::kernelName(kernel) << " position " << i;
+        }
+    }
+};
+
+TEST_F(BatchEvaluationTests, BatchLayout) {
+    ASSERT_EQ(batch.size(), positions.size());
+    EXPECT_EQ(batch.size() % 8, 3u);  // Exercises the scalar tail
+    EXPECT_EQ(batch.player1[0], positions[0].getBitBoard().pieces[0]);
+    EXPECT_EQ(batch.sideToMove[0], 1);
+    
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(BatchEvaluationTests, ScalarMatchesEvaluation) {
+    expectKernelMatches(BatchEvaluation::Kernel::Scalar);
+}
+
+TEST_F(BatchEvaluationTests, Sse2MatchesEvaluation) {
+    if (!BatchEvaluation::isSupported(BatchEvaluation::Kernel::SSE2)) GTEST_SKIP() << "SSE2 not available";
+    expectKernelMatches(BatchEvaluation::Kernel::SSE2);
+}
+
+TEST_F(BatchEvaluationTests, Avx2MatchesEvaluation) {
+    if (!BatchEvaluation::isSupported(BatchEvaluation::Kernel::AVX2)) GTEST_SKIP() << "AVX2 not available";
+    expectKernelMatches(BatchEvaluation::Kernel::AVX2);
+}
+
+TEST_F(BatchEvaluationTests, DefaultKernelMatchesEvaluation) {
+    auto scores = BatchEvaluation::evaluate(batch);
+    ASSERT_EQ(scores.size(), positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+        ASSERT_EQ(scores[i], Evaluation::evaluate(positions[i]));
+    }
+    EXPECT_TRUE(BatchEvaluation::isSupported(BatchEvaluation::bestKernel()));
+}
+
+TEST_F(BatchEvaluationTests, UnsupportedKernelFallsBack) {
+    PositionBatch small;
+    GameModel model;
+    model.initializeStandardGame("Player1", "Player2");
+    small.add(model);
+    
+    int32_t score = -1;
+    BatchEvaluation::evaluate(small, &score, BatchEvaluation::Kernel::AVX2);
+    EXPECT_EQ(score, 0);
+}
+
+TEST_F(BatchEvaluationTests, RejectsPositionsWithoutSideToMove) {
+    PositionBatch small;
+    GameModel model;
+    EXPECT_EQ(model.getCurrentSide(), NO_SIDE);
+    EXPECT_FALSE(small.add(model));
+    EXPECT_FALSE(small.add(model.getBitBoard(), NO_SIDE));
+    EXPECT_TRUE(small.empty());
+    
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_TRUE(small.add(model));
+    EXPECT_EQ(small.size(), 1u);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "BitBoard.h"
+#include "MoveTables.h"
+#include "GameModel.h"
+
+// BitBoard Tests
+// Tests the packed 32-square board core and its mapping to board positions
+class BitBoardTests : public ::testing::Test {
+protected:
+    GameModel model;
+};
+
+TEST_F(BitBoardTests, SquareIndexRoundTrip) {
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        Position pos = squarePosition(square);
+        EXPECT_TRUE(isPlayableSquare(pos));
+        EXPECT_EQ(squareIndex(pos), square);
+    }
+    
+    // Squares are numbered in Position order
+    EXPECT_TRUE(squarePosition(0) == Position(0, 0));
+    EXPECT_TRUE(squarePosition(4) == Position(1, 1));
+    EXPECT_TRUE(squarePosition(31) == Position(7, 7));
+    EXPECT_FALSE(isPlayableSquare({0, 1}));
+}
+
+TEST_F(BitBoardTests, ShiftSquaresStaysOnDiagonals) {
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        Position from = squarePosition(square);
+        const int deltas[NUM_DIRECTIONS][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+        
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            Position to{from.x + deltas[dir][0], from.y + deltas[dir][1]};
+            uint32_t shifted = shiftSquares(1u << square, dir);
+            
+            if (to.x < 0 || to.x > 7 || to.y < 0 || to.y > 7) {
+                EXPECT_EQ(shifted, 0u) << "square " << square << " dir " << dir;
+            } else {
+                EXPECT_EQ(shifted, 1u << squareIndex(to)) << "square " << square << " dir " << dir;
+            }
+        }
+    }
+}
+
+TEST_F(BitBoardTests, MoveTablesMatchShifts) {
+    static_assert(MOVE_TABLES.step[0][DOWN_RIGHT] == (1u << 4), "tables are built at compile time");
+    
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        for (int dir = 0; dir < NUM_DIRECTIONS; ++dir) {
+            uint32_t bit = shiftSquares(1u << square, dir);
+            EXPECT_EQ(MOVE_TABLES.step[square][dir], bit);
+            EXPECT_EQ(MOVE_TABLES.jump[square][dir], shiftSquares(bit, dir));
+            
+            // Ray walks to the edge and is zero-terminated
+            uint32_t mask = 0;
+            int length = 0;
+            for (; bit; bit = shiftSquares(bit, dir), ++length) {
+                EXPECT_EQ(MOVE_TABLES.ray[square][dir][length], bit);
+                mask |= bit;
+            }
+            EXPECT_EQ(MOVE_TABLES.ray[square][dir][length], 0u);
+            EXPECT_EQ(MOVE_TABLES.rayMask[square][dir], mask);
+        }
+        
+        for (int side = 0; side < NUM_SIDES; ++side) {
+            for (int i = 0; i < 2; ++i) {
+                EXPECT_EQ(MOVE_TABLES.pionStep[side][square][i], MOVE_TABLES.step[square][PION_DIRECTIONS[side][i]]);
+                EXPECT_EQ(MOVE_TABLES.pionJump[side][square][i], MOVE_TABLES.jump[square][PION_DIRECTIONS[side][i]]);
+            }
+        }
+    }
+}
+
+TEST_F(BitBoardTests, StandardGameMasks) {
+    model.initializeStandardGame("Player1", "Player2");
+    
+    const BitBoard& board = model.getBitBoard();
+    EXPECT_EQ(popCount(board.pieces[0]), 8);
+    EXPECT_EQ(popCount(board.pieces[1]), 8);
+    EXPECT_EQ(board.dames, 0u);
+    EXPECT_EQ(board.pieces[0] & board.pieces[1], 0u);
+    
+    auto grid = model.getBoard();
+    for (uint32_t mask = board.occupied(); mask; ) {
+        Position pos = squarePosition(popLowestSquare(mask));
+        ASSERT_NE(grid[pos.x][pos.y], nullptr);
+        EXPECT_EQ(grid[pos.x][pos.y]->getPosition().x, pos.x);
+        EXPECT_EQ(grid[pos.x][pos.y]->getPosition().y, pos.y);
+    }
+}
+
+TEST_F(BitBoardTests, BoardViewOwnsItsPieces) {
+    model.initializeStandardGame("Player1", "Player2");
+    BoardView first = model.getBoard();
+    Piece* piece = first[0][0];
+    ASSERT_NE(piece, nullptr);
+
+    // Later views and moves leave an earlier view untouched
+    MoveList moves;
+    model.generateMoves(moves);
+    model.executeMove(model.toMove(moves[0]));
+    BoardView second = model.getBoard();
+    EXPECT_NE(second[0][0], piece);
+    EXPECT_EQ(first[0][0], piece);
+    EXPECT_EQ(piece->getColor(), "Player1");
+
+    // A copy points at its own pieces
+    BoardView copy = first;
+    ASSERT_NE(copy[0][0], nullptr);
+    EXPECT_NE(copy[0][0], piece);
+    EXPECT_EQ(copy[0][0]->getPosition().x, 0);
+    EXPECT_EQ(copy.size(), 8u);
+}
+
+TEST_F(BitBoardTests, GridRoundTripKeepsTypes) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[3][3] = new Piece("Player1", {3, 3});
+    grid[3][3]->promote();
+    grid[5][5] = new Piece("Player2", {5, 5});
+    model.initializeFromGrid(grid);
+    
+    const BitBoard& board = model.getBitBoard();
+    EXPECT_EQ(board.pieces[0], 1u << squareIndex({3, 3}));
+    EXPECT_EQ(board.pieces[1], 1u << squareIndex({5, 5}));
+    EXPECT_EQ(board.dames, 1u << squareIndex({3, 3}));
+    EXPECT_EQ(model.getPieceCount("Player1"), 1);
+    EXPECT_EQ(model.getPieceCount("Player2"), 1);
+    
+    auto view = model.getBoard();
+    ASSERT_NE(view[3][3], nullptr);
+    EXPECT_TRUE(view[3][3]->isDame());
+    EXPECT_EQ(view[3][3]->getColor(), "Player1");
+    ASSERT_NE(view[5][5], nullptr);
+    EXPECT_TRUE(view[5][5]->isPion());
+    EXPECT_EQ(view[5][5]->getColor(), "Player2");
+    
+    delete grid[3][3];
+    delete grid[5][5];
+}
+
+TEST_F(BitBoardTests, CaptureUpdatesMasks) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[5][1] = new Piece("Player1", {5, 1});
+    grid[6][2] = new Piece("Player2", {6, 2});
+    model.initializeFromGrid(grid);
+    
+    auto moves = model.getValidMoves({5, 1});
+    ASSERT_EQ(moves.size(), 1u);
+    model.executeMove(moves[0]);
+    
+    // Capture lands on row 7 and promotes
+    const BitBoard& board = model.getBitBoard();
+    EXPECT_EQ(board.pieces[0], 1u << squareIndex({7, 3}));
+    EXPECT_EQ(board.pieces[1], 0u);
+    EXPECT_EQ(board.dames, 1u << squareIndex({7, 3}));
+    EXPECT_EQ(model.getPieceCount("Player2"), 0);
+    
+    delete grid[5][1];
+    delete grid[6][2];
+}
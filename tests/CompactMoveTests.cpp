@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "GameModel.h"
+#include "CompactMove.h"
+#include <type_traits>
+#include <unordered_set>
+
+// CompactMove Tests
+// Tests the packed 32-bit move encoding and its conversion to and from Move
+class CompactMoveTests : public ::testing::Test {
+protected:
+    GameModel model;
+    
+    static bool sameMove(const Move& a, const Move& b) {
+        if (!(a.from == b.from) || a.player != b.player) return false;
+        if (a.path.size() != b.path.size() || a.captured.size() != b.captured.size()) return false;
+        for (size_t i = 0; i < a.path.size(); ++i) {
+            if (!(a.path[i] == b.path[i])) return false;
+        }
+        for (size_t i = 0; i < a.captured.size(); ++i) {
+            if (!(a.captured[i] == b.captured[i])) return false;
+        }
+        return true;
+    }
+    
+    void expectRoundTrip() {
+        for (const auto& [pos, moves] : model.getAllValidMoves()) {
+            for (const auto& move : moves) {
+                CompactMove compact = model.encodeMove(move);
+                EXPECT_FALSE(compact.isNull());
+                EXPECT_EQ(compact.captureCount(), move.captureCount());
+                EXPECT_TRUE(sameMove(model.decodeMove(compact), move));
+                EXPECT_EQ(CompactMove::fromRaw(compact.raw()), compact);
+            }
+        }
+    }
+};
+
+TEST_F(CompactMoveTests, TriviallyCopyable32Bits) {
+    EXPECT_EQ(sizeof(CompactMove), 4u);
+    EXPECT_TRUE(std::is_trivially_copyable<CompactMove>::value);
+    EXPECT_TRUE(CompactMove().isNull());
+}
+
+TEST_F(CompactMoveTests, FieldsPacked) {
+    uint32_t captured = (1u << squareIndex({3, 3})) | (1u << squareIndex({5, 5}));
+    CompactMove move = CompactMove::make(squareIndex({2, 2}), squareIndex({6, 6}), captured, false);
+    
+    EXPECT_EQ(move.from(), squareIndex({2, 2}));
+    EXPECT_EQ(move.to(), squareIndex({6, 6}));
+    EXPECT_TRUE(move.isCapture());
+    EXPECT_EQ(move.captureCount(), 2);
+    EXPECT_EQ(move.capturedMask(), captured);
+    EXPECT_FALSE(move.isPromotion());
+}
+
+TEST_F(CompactMoveTests, RoundTripStandardOpening) {
+    model.initializeStandardGame("Player1", "Player2");
+    expectRoundTrip();
+}
+
+TEST_F(CompactMoveTests, RoundTripDameCaptures) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[1][1] = new Piece("Player1", {1, 1});
+    grid[1][1]->promote();
+    grid[2][2] = new Piece("Player2", {2, 2});
+    grid[4][4] = new Piece("Player2", {4, 4});
+    grid[5][3] = new Piece("Player2", {5, 3});
+    model.initializeFromGrid(grid);
+    expectRoundTrip();
+    
+    for (auto& row : grid) for (auto* piece : row) delete piece;
+}
+
+TEST_F(CompactMoveTests, PromotionFlag) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[6][6] = new Piece("Player1", {6, 6});
+    model.initializeFromGrid(grid);
+    
+    MoveList moves;
+    model.generateMoves(moves);
+    ASSERT_FALSE(moves.empty());
+    for (const auto& entry : moves) {
+        EXPECT_TRUE(model.encodeMove(entry).isPromotion());
+    }
+    expectRoundTrip();
+    
+    delete grid[6][6];
+}
+
+TEST_F(CompactMoveTests, HashableAndDistinct) {
+    model.initializeStandardGame("Player1", "Player2");
+    MoveList moves;
+    model.generateMoves(moves);
+    
+    std::unordered_set<CompactMove> unique;
+    for (const auto& entry : moves) unique.insert(model.encodeMove(entry));
+    EXPECT_EQ(static_cast<int>(unique.size()), moves.size());
+}
+
+TEST_F(CompactMoveTests, DecodeIllegalMoveIsEmpty) {
+    model.initializeStandardGame("Player1", "Player2");
+    uint32_t captured = 1u << squareIndex({3, 3});
+    Move move = model.decodeMove(CompactMove::make(squareIndex({2, 2}), squareIndex({4, 4}), captured, false));
+    EXPECT_TRUE(move.path.empty());
+}
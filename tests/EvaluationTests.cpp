@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "Evaluation.h"
+#include "GameModel.h"
+#include "TestPositions.h"
+#include "PieceSquareTables.h"
+
+// Evaluation Tests
+// Tests the incremental piece-square sums and the static evaluation
+class EvaluationTests : public ::testing::Test {
+protected:
+    GameModel model;
+    
+    void expectMatchesFullScore() {
+        for (int side = 0; side < NUM_SIDES; ++side) {
+            ASSERT_EQ(model.getPieceSquareScore(side), pieceSquareScore(model.getBitBoard(), side));
+        }
+    }
+};
+
+TEST_F(EvaluationTests, IncrementalMatchesFullScore) {
+    model.initializeStandardGame("Player1", "Player2");
+    expectMatchesFullScore();
+    
+    walkGame(model, 120, 0, [&](const MoveList& moves, int) {
+        expectMatchesFullScore();
+        int before[NUM_SIDES] = {model.getPieceSquareScore(0), model.getPieceSquareScore(1)};
+        for (const auto& entry : moves) {
+            GameModel::UndoInfo undo = model.makeMove(entry);
+            expectMatchesFullScore();
+            model.unmakeMove(undo);
+            EXPECT_EQ(model.getPieceSquareScore(0), before[0]);
+            EXPECT_EQ(model.getPieceSquareScore(1), before[1]);
+        }
+    });
+}
+
+TEST_F(EvaluationTests, PromotionAndCapturesUpdateScores) {
+    // (5,1) takes the Pion on (6,2) and promotes on (7,3)
+    setUpPosition(model, "1:.............O......x....o......");
+    int before = model.getPieceSquareScore(0);
+    
+    MoveList moves;
+    model.generateMoves(moves);
+    ASSERT_EQ(moves.size(), 1);
+    model.makeMove(moves[0]);
+    expectMatchesFullScore();
+    EXPECT_GT(model.getPieceSquareScore(0) - before, DAME_VALUE - PION_VALUE - 30);
+    EXPECT_EQ(model.getPieceSquareScore(1), PIECE_SQUARE_TABLES.value[1][DAME_KIND][squareIndex({3, 3})]);
+}
+
+TEST_F(EvaluationTests, SymmetricOpeningIsLevel) {
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_EQ(model.getPieceSquareScore(0), model.getPieceSquareScore(1));
+    EXPECT_EQ(Evaluation::evaluate(model), 0);
+}
+
+TEST_F(EvaluationTests, ScoresFromSideToMove) {
+    setUpPosition(model, "1:....xx.....................o....");
+    int forPlayer1 = Evaluation::evaluate(model);
+    EXPECT_GT(forPlayer1, 0);
+    
+    setUpPosition(model, "2:....xx.....................o....");
+    EXPECT_EQ(Evaluation::evaluate(model), -forPlayer1);
+}
+
+TEST_F(EvaluationTests, PositionalTerms) {
+    const auto& table = PIECE_SQUARE_TABLES.value;
+    
+    // Dames outweigh Pions, advanced Pions outweigh fresh ones
+    EXPECT_GT(table[0][DAME_KIND][squareIndex({3, 3})], table[0][PION_KIND][squareIndex({6, 6})]);
+    EXPECT_GT(table[0][PION_KIND][squareIndex({5, 3})], table[0][PION_KIND][squareIndex({2, 2})]);
+    EXPECT_GT(table[1][PION_KIND][squareIndex({2, 2})], table[1][PION_KIND][squareIndex({5, 3})]);
+    
+    // Centre beats edge, and home-row Pions carry the guard bonus
+    EXPECT_GT(table[0][DAME_KIND][squareIndex({3, 3})], table[0][DAME_KIND][squareIndex({3, 7})]);
+    EXPECT_GT(table[0][PION_KIND][squareIndex({0, 2})], table[0][PION_KIND][squareIndex({1, 1})]);
+    EXPECT_GT(table[1][PION_KIND][squareIndex({7, 5})], table[1][PION_KIND][squareIndex({6, 6})]);
+}
+
+TEST_F(EvaluationTests, MobilityCountsSteps) {
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_EQ(Evaluation::mobility(model.getBitBoard(), 0), 7);
+    EXPECT_EQ(Evaluation::mobility(model.getBitBoard(), 1), 7);
+    
+    // A lone central Dame has four first steps
+    setUpPosition(model, "1:.............X.................o");
+    EXPECT_EQ(Evaluation::mobility(model.getBitBoard(), 0), 4);
+}
+
+TEST_F(EvaluationTests, PieceCountUsesBitboard) {
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_EQ(model.getPieceCount("Player1"), 8);
+    EXPECT_EQ(model.getPieceCount("Player2"), 8);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "GameModel.h"
+#include "TestPositions.h"
 #include <set>
 
 // Game Logic Tests
@@ -115,6 +116,39 @@ TEST_F(GameLogicTests, GameOver) {
     // Player1 at bottom corner cannot move forward
     EXPECT_TRUE(model.isGameOver());
     EXPECT_EQ(model.getWinner(), "Player2");
+    EXPECT_EQ(model.getWinnerSide(), 1);
+}
+
+TEST_F(GameLogicTests, GameResultQueries) {
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_TRUE(model.hasAnyLegalMove());
+    EXPECT_EQ(model.getWinnerSide(), NO_SIDE);
+    EXPECT_EQ(model.getWinner(), "");
+
+    // Player2 to move with no pieces left
+    setUpPosition(model, "2:x...............................");
+    EXPECT_FALSE(model.hasAnyLegalMove());
+    EXPECT_EQ(model.getWinnerSide(), 0);
+    EXPECT_EQ(model.getWinner(), "Player1");
+
+    // A Pion with both steps blocked that can still capture
+    setUpPosition(model, "1:.........x..oo..................");
+    EXPECT_FALSE(model.hasQuietMove());
+    EXPECT_TRUE(model.hasAnyLegalMove());
+    EXPECT_FALSE(model.isGameOver());
+}
+
+TEST_F(GameLogicTests, HasAnyLegalMoveMatchesGenerator) {
+    for (int seed = 0; seed < 40; ++seed) {
+        model.initializeStandardGame("Player1", "Player2");
+        walkGame(model, 200, seed, [&](const MoveList& moves, int) {
+            ASSERT_EQ(model.hasAnyLegalMove(), !moves.empty());
+            ASSERT_EQ(model.isGameOver(), model.getAllValidMoves().empty());
+            if (moves.empty()) {
+                EXPECT_EQ(model.getWinnerSide(), 1 - model.getCurrentSide());
+            }
+        });
+    }
 }
 
 TEST_F(GameLogicTests, CloneModel) {
@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "GameRecordFile.h"
+#include "MoveList.h"
+#include "OpeningBook.h"
+#include "SelfPlay.h"
+#include "TestPositions.h"
+
+// GameRecordFile Tests
+// Tests the binary record format, the live-model writer and the streaming reader
+class GameRecordFileTests : public ::testing::Test {
+protected:
+    GameModel start;
+    std::string path;
+
+    void SetUp() override {
+        start.initializeStandardGame("Player1", "Player2");
+        path = (std::filesystem::temp_directory_path() / "thai_checkers_game_record_test.tcgr").string();
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    void writeBytes(const std::vector<uint8_t>& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    static std::vector<uint8_t> header() {
+        return {'T', 'C', 'G', 'R', 1, 0, 0, 0};
+    }
+
+    // First legal move in generator order, encoded
+    static CompactMove firstMove(const GameModel& model) {
+        MoveList legal;
+        model.generateMoves(legal);
+        return model.encodeMove(legal[0]);
+    }
+};
+
+TEST_F(GameRecordFileTests, RoundTripsSelfPlayGames) {
+    SelfPlayRunner runner(makePolicyFactory("random"), makePolicyFactory("random"));
+    SelfPlayConfig config;
+    config.games = 2000;
+    config.threads = 1;
+    std::vector<GameRecord> played;
+    {
+        GameRecordWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        runner.run(config, [&](const GameRecord& record) {
+            played.push_back(record);
+            writer.beginGame(start);
+            for (const auto& move : record.moves) writer.addMove(move);
+            writer.endGame(record.winner);
+        });
+        EXPECT_EQ(writer.gameCount(), 2000u);
+    }
+
+    // Larger than the reader's buffer, so it refills mid-game
+    EXPECT_GT(std::filesystem::file_size(path), 1u << 17);
+
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    RecordedGame game;
+    size_t count = 0;
+    while (reader.next(game)) {
+        ASSERT_LT(count, played.size());
+        EXPECT_TRUE(game.standardStart);
+        EXPECT_EQ(game.winner, played[count].winner);
+        ASSERT_EQ(game.moves.size(), played[count].moves.size());
+        for (size_t i = 0; i < game.moves.size(); ++i) ASSERT_EQ(game.moves[i], played[count].moves[i]);
+        ++count;
+    }
+    EXPECT_FALSE(reader.failed());
+    EXPECT_EQ(count, played.size());
+}
+
+TEST_F(GameRecordFileTests, AttachedWriterRecordsExecutedMoves) {
+    GameModel model(start);
+    GameRecordWriter writer;
+    ASSERT_TRUE(writer.open(path));
+    writer.attach(model);
+    EXPECT_EQ(model.getMoveObserver(), &writer);
+
+    walkGame(model, 30, 0, [](const MoveList&, int) {});
+
+    // Copies don't record their moves into the original's game
+    GameModel copy(model);
+    GameModel assigned;
+    assigned = model;
+    EXPECT_EQ(copy.getMoveObserver(), nullptr);
+    EXPECT_EQ(assigned.getMoveObserver(), nullptr);
+    walkGame(copy, 10, 1, [](const MoveList&, int) {});
+    walkGame(assigned, 10, 2, [](const MoveList&, int) {});
+    EXPECT_EQ(model.getMoveObserver(), &writer);
+
+    writer.detach(model, 1);
+    EXPECT_EQ(model.getMoveObserver(), nullptr);
+    writer.close();
+
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    GameModel replayed;
+    int winner = NO_SIDE;
+    ASSERT_TRUE(reader.replay(replayed, winner));
+    EXPECT_EQ(winner, 1);
+    EXPECT_TRUE(replayed.getBitBoard() == model.getBitBoard());
+    EXPECT_EQ(replayed.getHash(), model.getHash());
+    EXPECT_EQ(replayed.getMoveHistory().size(), model.getMoveHistory().size());
+    EXPECT_FALSE(reader.replay(replayed, winner));
+    EXPECT_FALSE(reader.failed());
+}
+
+TEST_F(GameRecordFileTests, KeepsCustomStartPositions) {
+    BitBoard board;
+    board.pieces[0] = squareBit({2, 2}) | squareBit({0, 6});
+    board.pieces[1] = squareBit({3, 3}) | squareBit({7, 1});
+    board.dames = squareBit({0, 6}) | squareBit({7, 1});
+    GameModel model;
+    model.initializeFromBitBoard("Player1", "Player2", board, 1);
+
+    RecordedGame game;
+    game.standardStart = false;
+    game.start = board;
+    game.sideToMove = 1;
+    game.moves.push_back(firstMove(model));
+    game.winner = 0;
+    {
+        GameRecordWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        writer.writeGame(game);
+    }
+
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    RecordedGame read;
+    ASSERT_TRUE(reader.next(read));
+    EXPECT_FALSE(read.standardStart);
+    EXPECT_TRUE(read.start == board);
+    EXPECT_EQ(read.sideToMove, 1);
+    ASSERT_EQ(read.moves.size(), 1u);
+    EXPECT_EQ(read.moves[0], game.moves[0]);
+    EXPECT_EQ(read.winner, 0);
+}
+
+TEST_F(GameRecordFileTests, QuietMovesTakeTwoBytesAndCapturesFive) {
+    GameModel model;
+    setUpPosition(model, "1:.........x...o..................");
+    CompactMove capture = firstMove(model);
+    ASSERT_TRUE(capture.isCapture());
+    {
+        GameRecordWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        writer.beginGame(start);
+        writer.addMove(firstMove(start));
+        writer.endGame(NO_SIDE);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 8u + 1u + 2u + 1u);
+
+    std::filesystem::remove(path);
+    {
+        GameRecordWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        writer.beginGame(model);
+        writer.addMove(capture);
+        writer.endGame(0);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 8u + 13u + 5u + 1u);
+}
+
+TEST_F(GameRecordFileTests, AppendsToExistingFile) {
+    for (int run = 0; run < 2; ++run) {
+        GameRecordWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        writer.beginGame(start);
+        writer.addMove(firstMove(start));
+        writer.endGame(run);
+    }
+
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    RecordedGame game;
+    ASSERT_TRUE(reader.next(game));
+    EXPECT_EQ(game.winner, 0);
+    ASSERT_TRUE(reader.next(game));
+    EXPECT_EQ(game.winner, 1);
+    EXPECT_FALSE(reader.next(game));
+    EXPECT_FALSE(reader.failed());
+}
+
+TEST_F(GameRecordFileTests, RejectsOtherFiles) {
+    writeBytes({'T', 'C', 'B', 'K', 1, 0, 0, 0});
+    GameRecordWriter writer;
+    EXPECT_FALSE(writer.open(path));
+    GameRecordReader reader;
+    EXPECT_FALSE(reader.open(path));
+
+    // Records aren't appended under another version's header
+    writeBytes({'T', 'C', 'G', 'R', 2, 0, 0, 0});
+    EXPECT_FALSE(writer.open(path));
+    EXPECT_FALSE(reader.open(path));
+    EXPECT_EQ(std::filesystem::file_size(path), 8u);
+    EXPECT_FALSE(reader.open("/nonexistent/records.tcgr"));
+}
+
+TEST_F(GameRecordFileTests, InterruptedGamesAreUnfinished) {
+    CompactMove move = firstMove(start);
+    std::vector<uint8_t> bytes = header();
+    // A game cut off by the next game's start, then one cut off by the end
+    bytes.insert(bytes.end(), {0xC0, static_cast<uint8_t>(move.from()), static_cast<uint8_t>(move.to()),
+                               0xC0, static_cast<uint8_t>(move.from()), static_cast<uint8_t>(move.to()), 0x81,
+                               0xC0, static_cast<uint8_t>(move.from())});
+    writeBytes(bytes);
+
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    RecordedGame game;
+    ASSERT_TRUE(reader.next(game));
+    EXPECT_EQ(game.winner, NO_SIDE);
+    EXPECT_EQ(game.moves.size(), 1u);
+    ASSERT_TRUE(reader.next(game));
+    EXPECT_EQ(game.winner, 0);
+    EXPECT_EQ(game.moves.size(), 1u);
+    EXPECT_FALSE(reader.next(game));
+    EXPECT_FALSE(reader.failed());
+}
+
+TEST_F(GameRecordFileTests, MalformedDataFails) {
+    std::vector<uint8_t> bytes = header();
+    bytes.insert(bytes.end(), {0xC0, 0x49, 0x0D, 0x81});   // Move byte with a stray bit
+    writeBytes(bytes);
+
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    RecordedGame game;
+    EXPECT_FALSE(reader.next(game));
+    EXPECT_TRUE(reader.failed());
+
+    // A well-formed but illegal move stops replay
+    bytes = header();
+    bytes.insert(bytes.end(), {0xC0, 0x00, 0x1F, 0x80});
+    writeBytes(bytes);
+    ASSERT_TRUE(reader.open(path));
+    GameModel model;
+    int winner;
+    EXPECT_FALSE(reader.replay(model, winner));
+    EXPECT_TRUE(reader.failed());
+}
+
+TEST_F(GameRecordFileTests, BuildsOpeningBookFromRecords) {
+    {
+        GameRecordWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        for (int i = 0; i < 3; ++i) {
+            writer.beginGame(start);
+            writer.addMove(firstMove(start));
+            writer.endGame(0);
+        }
+    }
+
+    OpeningBookBuilder builder(4);
+    GameRecordReader reader;
+    ASSERT_TRUE(reader.open(path));
+    RecordedGame game;
+    GameModel model;
+    while (reader.next(game)) {
+        game.setUp(model);
+        builder.addGame(model, game.moves, game.winner);
+    }
+    EXPECT_EQ(builder.gameCount(), 3u);
+    EXPECT_EQ(builder.size(), 1u);
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "MCTSEngine.h"
+#include "GameModel.h"
+#include "TestPositions.h"
+
+// MCTSEngine Tests
+// Tests move selection, budgets, determinism and tree reuse
+class MCTSEngineTests : public ::testing::Test {
+protected:
+    GameModel model;
+    MCTSEngine engine{4, 1, 11};
+    MCTSLimits limits;
+
+    void SetUp() override {
+        model.initializeStandardGame("Player1", "Player2");
+        limits.maxSimulations = 400;
+    }
+};
+
+TEST_F(MCTSEngineTests, ReturnsLegalMoveFromOpening) {
+    MCTSResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_TRUE(isLegalMove(model, result.bestMove));
+    EXPECT_EQ(result.simulations, 400u);
+    EXPECT_GT(result.visits, 0u);
+    EXPECT_GT(result.nodes, 1u);
+    EXPECT_GE(result.winRate, 0.0);
+    EXPECT_LE(result.winRate, 1.0);
+}
+
+TEST_F(MCTSEngineTests, LeavesModelUnchanged) {
+    BitBoard before = model.getBitBoard();
+    uint64_t hash = model.getHash();
+
+    engine.search(model, limits);
+    EXPECT_TRUE(model.getBitBoard() == before);
+    EXPECT_EQ(model.getHash(), hash);
+    EXPECT_EQ(model.getCurrentSide(), 0);
+}
+
+TEST_F(MCTSEngineTests, ScoresWinningCaptureAsCertain) {
+    // Taking the last opposing piece wins at once
+    setUpPosition(model, "1:.........x...o..................");
+    MCTSResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    ASSERT_EQ(result.bestMove.captured.size(), 1u);
+    EXPECT_DOUBLE_EQ(result.winRate, 1.0);
+}
+
+TEST_F(MCTSEngineTests, NoMovesHasNoMove) {
+    setUpPosition(model, "2:.........x......................");
+    MCTSResult result = engine.search(model, limits);
+    EXPECT_FALSE(result.hasMove());
+    EXPECT_EQ(result.simulations, 0u);
+}
+
+TEST_F(MCTSEngineTests, OneThreadIsDeterministic) {
+    MCTSResult first = engine.search(model, limits);
+
+    MCTSEngine other(4, 1, 11);
+    MCTSResult second = other.search(model, limits);
+    EXPECT_EQ(first.bestMove.path, second.bestMove.path);
+    EXPECT_EQ(first.visits, second.visits);
+    EXPECT_EQ(first.nodes, second.nodes);
+}
+
+TEST_F(MCTSEngineTests, ReusesSubtreeAfterTwoPlies) {
+    MCTSResult first = engine.search(model, limits);
+    EXPECT_EQ(first.reusedVisits, 0u);
+
+    // Follow the most visited line, so its subtree has statistics
+    model.executeMove(first.bestMove);
+    MCTSResult reply = engine.search(model, limits);
+    EXPECT_EQ(reply.reusedVisits, first.visits);
+    model.executeMove(reply.bestMove);
+
+    MCTSResult second = engine.search(model, limits);
+    EXPECT_GT(second.reusedVisits, 0u);
+    EXPECT_TRUE(isLegalMove(model, second.bestMove));
+
+    // Same position again keeps the whole tree
+    MCTSResult again = engine.search(model, limits);
+    EXPECT_EQ(again.reusedVisits, second.reusedVisits + 400u);
+
+    engine.clear();
+    EXPECT_EQ(engine.treeSize(), 0u);
+    EXPECT_EQ(engine.search(model, limits).reusedVisits, 0u);
+}
+
+TEST_F(MCTSEngineTests, RespectsNodeBudget) {
+    limits.maxNodes = 64;
+    MCTSResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_EQ(result.simulations, 400u);
+    EXPECT_LE(result.nodes, 64u);
+    EXPECT_LE(engine.treeSize(), engine.capacity());
+}
+
+TEST_F(MCTSEngineTests, StopsOnTimeBudget) {
+    limits.maxSimulations = 0;
+    limits.maxTimeMs = 50;
+    MCTSResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_GT(result.simulations, 0u);
+    EXPECT_LT(result.seconds, 5.0);
+}
+
+TEST_F(MCTSEngineTests, ParallelSearchCountsEverySimulation) {
+    engine.setThreads(4);
+    EXPECT_EQ(engine.threadCount(), 4u);
+    limits.maxSimulations = 2000;
+
+    MCTSResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_TRUE(isLegalMove(model, result.bestMove));
+    EXPECT_EQ(result.simulations, 2000u);
+}
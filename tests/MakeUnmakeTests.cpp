@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "GameModel.h"
+#include "MoveList.h"
+
+// Make/Unmake Tests
+// Tests in-place move application and its exact reversal
+class MakeUnmakeTests : public ::testing::Test {
+protected:
+    GameModel model;
+    
+    uint64_t countLeaves(int depth) {
+        if (depth == 0) return 1;
+        MoveList moves;
+        model.generateMoves(moves);
+        uint64_t nodes = 0;
+        for (const auto& entry : moves) {
+            GameModel::UndoInfo undo = model.makeMove(entry);
+            nodes += countLeaves(depth - 1);
+            model.unmakeMove(undo);
+        }
+        return nodes;
+    }
+};
+
+TEST_F(MakeUnmakeTests, RestoresStandardPosition) {
+    model.initializeStandardGame("Player1", "Player2");
+    BitBoard before = model.getBitBoard();
+    
+    EXPECT_EQ(countLeaves(5), 26592u);
+    EXPECT_TRUE(model.getBitBoard() == before);
+    EXPECT_EQ(model.getCurrentPlayer(), "Player1");
+    EXPECT_TRUE(model.getMoveHistory().empty());
+}
+
+TEST_F(MakeUnmakeTests, RestoresCapturedDamesAndPromotion) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[4][2] = new Piece("Player1", {4, 2});
+    grid[5][3] = new Piece("Player2", {5, 3});
+    grid[5][3]->promote();
+    model.initializeFromGrid(grid);
+    model.setCurrentPlayer("Player2");
+    BitBoard before = model.getBitBoard();
+    
+    // Player2's Dame must capture the Pion
+    MoveList moves;
+    model.generateMoves(moves);
+    ASSERT_EQ(moves.size(), 1);
+    GameModel::UndoInfo capture = model.makeMove(moves[0]);
+    EXPECT_EQ(model.getPieceCount("Player1"), 0);
+    EXPECT_EQ(model.getCurrentPlayer(), "Player1");
+    model.unmakeMove(capture);
+    EXPECT_TRUE(model.getBitBoard() == before);
+    EXPECT_EQ(model.getCurrentPlayer(), "Player2");
+    
+    // A Player1 Pion promotes and is demoted again on unmake
+    model.setCurrentPlayer("Player1");
+    model.generateMoves(moves);
+    ASSERT_FALSE(moves.empty());
+    GameModel::UndoInfo step = model.makeMove(moves[0]);
+    model.unmakeMove(step);
+    EXPECT_TRUE(model.getBitBoard() == before);
+    
+    for (auto& row : grid) for (auto* piece : row) delete piece;
+}
+
+TEST_F(MakeUnmakeTests, MatchesExecuteMove) {
+    model.initializeStandardGame("Player1", "Player2");
+    GameModel* reference = model.clone();
+    
+    for (int ply = 0; ply < 40; ++ply) {
+        MoveList moves;
+        model.generateMoves(moves);
+        if (moves.empty()) break;
+        
+        const auto& entry = moves[ply % moves.size()];
+        reference->executeMove(reference->toMove(entry));
+        model.makeMove(model.encodeMove(entry));
+        
+        ASSERT_TRUE(model.getBitBoard() == reference->getBitBoard());
+        ASSERT_EQ(model.getCurrentPlayer(), reference->getCurrentPlayer());
+    }
+    EXPECT_TRUE(model.getMoveHistory().empty());
+    EXPECT_FALSE(reference->getMoveHistory().empty());
+    
+    delete reference;
+}
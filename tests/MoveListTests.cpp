@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "GameModel.h"
+#include "MoveList.h"
+
+// MoveList Tests
+// Tests allocation-free move generation and its agreement with the map API
+class MoveListTests : public ::testing::Test {
+protected:
+    GameModel model;
+    MoveList moves;
+};
+
+TEST_F(MoveListTests, StandardOpeningMoves) {
+    model.initializeStandardGame("Player1", "Player2");
+    model.generateMoves(moves);
+    
+    // Four front-row Pions: three have two moves, the edge one has one
+    EXPECT_EQ(moves.size(), 7);
+    for (const auto& entry : moves) {
+        EXPECT_FALSE(entry.isCapture());
+        EXPECT_EQ(entry.length, 1);
+        EXPECT_EQ(squarePosition(entry.from).x, 1);
+        EXPECT_EQ(squarePosition(entry.to()).x, 2);
+    }
+}
+
+TEST_F(MoveListTests, CaptureSequenceStoredInline) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[2][2] = new Piece("Player1", {2, 2});
+    grid[3][3] = new Piece("Player2", {3, 3});
+    grid[5][5] = new Piece("Player2", {5, 5});
+    grid[1][1] = new Piece("Player1", {1, 1});  // Has simple moves, but capture is mandatory
+    model.initializeFromGrid(grid);
+    
+    model.generateMoves(moves);
+    ASSERT_EQ(moves.size(), 1);
+    
+    const auto& entry = moves[0];
+    EXPECT_EQ(entry.from, squareIndex({2, 2}));
+    ASSERT_EQ(entry.length, 2);
+    ASSERT_EQ(entry.captureCount(), 2);
+    EXPECT_EQ(entry.path[0], squareIndex({4, 4}));
+    EXPECT_EQ(entry.path[1], squareIndex({6, 6}));
+    EXPECT_EQ(entry.captured[0], squareIndex({3, 3}));
+    EXPECT_EQ(entry.captured[1], squareIndex({5, 5}));
+    EXPECT_EQ(entry.capturedMask, (1u << squareIndex({3, 3})) | (1u << squareIndex({5, 5})));
+    
+    Move move = model.toMove(entry);
+    EXPECT_EQ(move.player, "Player1");
+    EXPECT_TRUE(move.from == Position(2, 2));
+    ASSERT_EQ(move.path.size(), 2u);
+    EXPECT_TRUE(move.path[1] == Position(6, 6));
+    ASSERT_EQ(move.captured.size(), 2u);
+    EXPECT_TRUE(move.captured[0] == Position(3, 3));
+    
+    for (auto& row : grid) for (auto* piece : row) delete piece;
+}
+
+TEST_F(MoveListTests, MatchesMapApi) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[4][4] = new Piece("Player1", {4, 4});
+    grid[4][4]->promote();
+    grid[2][2] = new Piece("Player2", {2, 2});
+    grid[6][6] = new Piece("Player2", {6, 6});
+    grid[6][2] = new Piece("Player2", {6, 2});
+    model.initializeFromGrid(grid);
+    
+    model.generateMoves(moves);
+    auto allMoves = model.getAllValidMoves();
+    
+    int index = 0;
+    for (const auto& [pos, pieceMoves] : allMoves) {
+        for (const auto& move : pieceMoves) {
+            ASSERT_LT(index, moves.size());
+            Move listed = model.toMove(moves[index++]);
+            EXPECT_TRUE(listed.from == pos);
+            ASSERT_EQ(listed.path.size(), move.path.size());
+            for (size_t i = 0; i < move.path.size(); ++i) {
+                EXPECT_TRUE(listed.path[i] == move.path[i]);
+            }
+            ASSERT_EQ(listed.captured.size(), move.captured.size());
+            for (size_t i = 0; i < move.captured.size(); ++i) {
+                EXPECT_TRUE(listed.captured[i] == move.captured[i]);
+            }
+        }
+    }
+    EXPECT_EQ(index, moves.size());
+    
+    for (auto& row : grid) for (auto* piece : row) delete piece;
+}
+
+TEST_F(MoveListTests, NoMovesForUnknownPlayer) {
+    model.initializeStandardGame("Player1", "Player2");
+    model.setCurrentPlayer("Nobody");
+    model.generateMoves(moves);
+    EXPECT_TRUE(moves.empty());
+}
+
+TEST_F(MoveListTests, CaptureOnlyGeneration) {
+    // Quiet position: no captures are generated, but quiet moves exist
+    model.initializeStandardGame("Player1", "Player2");
+    model.generateCaptures(moves);
+    EXPECT_TRUE(moves.empty());
+    EXPECT_TRUE(model.hasQuietMove());
+    
+    // Forced capture: capture-only generation matches full generation
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[2][2] = new Piece("Player1", {2, 2});
+    grid[3][3] = new Piece("Player2", {3, 3});
+    grid[1][1] = new Piece("Player1", {1, 1});
+    model.initializeFromGrid(grid);
+    
+    MoveList all;
+    model.generateMoves(all);
+    model.generateCaptures(moves);
+    ASSERT_EQ(moves.size(), all.size());
+    for (int i = 0; i < moves.size(); ++i) {
+        EXPECT_TRUE(moves[i].isCapture());
+        EXPECT_EQ(moves[i].capturedMask, all[i].capturedMask);
+    }
+}
+
+TEST_F(MoveListTests, QuietMoveDetection) {
+    BitBoard board;
+    
+    // Player2 Pion on (7,7) is blocked by (6,6) and cannot jump it
+    board.pieces[0] = (1u << squareIndex({6, 6})) | (1u << squareIndex({5, 5}));
+    board.pieces[1] = 1u << squareIndex({7, 7});
+    model.initializeFromBitBoard("Player1", "Player2", board, 1);
+    EXPECT_FALSE(model.hasQuietMove());
+    model.generateMoves(moves);
+    EXPECT_TRUE(moves.empty());
+    
+    // A Dame has no other step from the corner either
+    board.dames = 1u << squareIndex({7, 7});
+    model.initializeFromBitBoard("Player1", "Player2", board, 1);
+    EXPECT_FALSE(model.hasQuietMove());
+    
+    // Player1 Pions stepping down the board have room
+    model.initializeFromBitBoard("Player1", "Player2", board, 0);
+    EXPECT_TRUE(model.hasQuietMove());
+}
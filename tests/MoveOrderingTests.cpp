@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "MoveOrdering.h"
+#include "GameModel.h"
+#include "TestPositions.h"
+
+// MoveOrdering Tests
+// Tests the ranking of generated moves for search
+class MoveOrderingTests : public ::testing::Test {
+protected:
+    GameModel model;
+    MoveOrdering ordering;
+    MoveList moves;
+    int scores[MAX_MOVES];
+    
+    // Generates, scores and fully orders the moves of the model
+    void order(CompactMove ttMove, int ply = 0) {
+        model.generateMoves(moves);
+        ordering.scoreMoves(model.getBitBoard(), model.getCurrentSide(), moves, ttMove, ply, scores);
+        for (int i = 0; i < moves.size(); ++i) MoveOrdering::pickNext(moves, scores, i);
+    }
+};
+
+TEST_F(MoveOrderingTests, CapturesRankByCount) {
+    // (1,1) can take two pieces via (3,3); (1,5) can take only one
+    setUpPosition(model, "1:....x.x..o.o......o.........o...");
+    order(CompactMove());
+    
+    ASSERT_GE(moves.size(), 2);
+    EXPECT_EQ(moves[0].captureCount(), 2);
+    for (int i = 1; i < moves.size(); ++i) {
+        EXPECT_LE(moves[i].captureCount(), moves[i - 1].captureCount());
+    }
+}
+
+TEST_F(MoveOrderingTests, CapturedDameBreaksTies) {
+    // (2,2) can take the Pion on (3,1) or the Dame on (3,3)
+    setUpPosition(model, "1:.........x..oO.................o");
+    order(CompactMove());
+    
+    ASSERT_EQ(moves.size(), 2);
+    EXPECT_EQ(moves[0].captured[0], squareIndex({3, 3}));
+}
+
+TEST_F(MoveOrderingTests, TableMoveComesFirst) {
+    model.initializeStandardGame("Player1", "Player2");
+    model.generateMoves(moves);
+    CompactMove ttMove = model.encodeMove(moves[moves.size() - 1]);
+    
+    order(ttMove);
+    EXPECT_EQ(model.encodeMove(moves[0]), ttMove);
+    EXPECT_EQ(scores[0], MoveOrdering::TT_MOVE_SCORE);
+}
+
+TEST_F(MoveOrderingTests, PromotionBeforeQuietMoves) {
+    setUpPosition(model, "1:...o.....x...............x......");
+    order(CompactMove());
+    
+    ASSERT_GE(moves.size(), 3);
+    EXPECT_EQ(squarePosition(moves[0].from), Position(6, 2));
+    EXPECT_EQ(scores[0], MoveOrdering::PROMOTION_SCORE);
+}
+
+TEST_F(MoveOrderingTests, CutoffSetsKillerAndHistory) {
+    model.initializeStandardGame("Player1", "Player2");
+    model.generateMoves(moves);
+    int cutoff = moves.size() - 1;
+    int from = moves[cutoff].from;
+    int to = moves[cutoff].to();
+    
+    ordering.recordCutoff(moves, cutoff, 0, 3, 4);
+    EXPECT_TRUE(ordering.isKiller(3, from, to));
+    EXPECT_FALSE(ordering.isKiller(4, from, to));
+    EXPECT_GT(ordering.historyScore(0, from, to), 0);
+    EXPECT_LT(ordering.historyScore(0, moves[0].from, moves[0].to()), 0);
+    
+    // The killer now leads the quiet moves at that ply
+    order(CompactMove(), 3);
+    EXPECT_EQ(moves[0].from, from);
+    EXPECT_EQ(moves[0].to(), to);
+    
+    ordering.clear();
+    EXPECT_FALSE(ordering.isKiller(3, from, to));
+    EXPECT_EQ(ordering.historyScore(0, from, to), 0);
+}
+
+TEST_F(MoveOrderingTests, HistoryStaysBounded) {
+    model.initializeStandardGame("Player1", "Player2");
+    model.generateMoves(moves);
+    for (int i = 0; i < 10000; ++i) ordering.recordCutoff(moves, 0, 0, 0, 40);
+    EXPECT_LE(ordering.historyScore(0, moves[0].from, moves[0].to()), MoveOrdering::MAX_HISTORY);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "GameModel.h"
+#include "TestPositions.h"
+
+// Notation Tests
+// Tests the one-line position notation written by toNotation and read by fromNotation
+class NotationTests : public ::testing::Test {
+protected:
+    GameModel model;
+
+    static constexpr const char* STANDARD = "1:xxxxxxxx................oooooooo";
+};
+
+TEST_F(NotationTests, StandardStart) {
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_EQ(model.toNotation(), STANDARD);
+    EXPECT_EQ(model.toNotation().size(), GameModel::NOTATION_LENGTH);
+
+    GameModel parsed;
+    ASSERT_TRUE(parsed.fromNotation(STANDARD));
+    EXPECT_TRUE(parsed.getBitBoard() == model.getBitBoard());
+    EXPECT_EQ(parsed.getCurrentSide(), 0);
+    EXPECT_EQ(parsed.getCurrentPlayer(), "Player1");
+    EXPECT_EQ(parsed.getHash(), model.getHash());
+    EXPECT_EQ(parsed.getPieceSquareScore(0), model.getPieceSquareScore(0));
+    EXPECT_EQ(parsed.getPieceSquareScore(1), model.getPieceSquareScore(1));
+}
+
+TEST_F(NotationTests, DamesAndSideToMove) {
+    BitBoard board;
+    board.pieces[0] = squareBit({2, 2}) | squareBit({0, 6});
+    board.pieces[1] = squareBit({3, 3}) | squareBit({7, 1});
+    board.dames = squareBit({0, 6}) | squareBit({7, 1});
+    model.initializeFromBitBoard("Player1", "Player2", board, 1);
+
+    std::string text = model.toNotation();
+    EXPECT_EQ(text[0], '2');
+    GameModel parsed;
+    ASSERT_TRUE(parsed.fromNotation(text));
+    EXPECT_TRUE(parsed.getBitBoard() == board);
+    EXPECT_EQ(parsed.getCurrentSide(), 1);
+    EXPECT_EQ(parsed.getCurrentPlayer(), "Player2");
+    EXPECT_EQ(parsed.getHash(), model.getHash());
+    EXPECT_EQ(parsed.toNotation(), text);
+}
+
+TEST_F(NotationTests, RoundTripsPlayedPositions) {
+    model.initializeStandardGame("Player1", "Player2");
+    GameModel parsed;
+    walkGame(model, 120, 0, [&](const MoveList&, int) {
+        ASSERT_TRUE(parsed.fromNotation(model.toNotation()));
+        ASSERT_TRUE(parsed.getBitBoard() == model.getBitBoard());
+        ASSERT_EQ(parsed.getHash(), model.getHash());
+    });
+}
+
+TEST_F(NotationTests, KeepsPlayerNamesAndClearsHistory) {
+    model.initializeStandardGame("Alice", "Bob");
+    MoveList moves;
+    model.generateMoves(moves);
+    model.executeMove(model.toMove(moves[0]));
+    ASSERT_EQ(model.getMoveHistory().size(), 1u);
+
+    ASSERT_TRUE(model.fromNotation("2:xxxxxxxx................oooooooo"));
+    EXPECT_EQ(model.getCurrentPlayer(), "Bob");
+    EXPECT_TRUE(model.getMoveHistory().empty());
+}
+
+TEST_F(NotationTests, RejectsMalformedText) {
+    model.initializeStandardGame("Player1", "Player2");
+    const std::string bad[] = {
+        "",
+        "xxxxxxxx................oooooooo",      // No side to move
+        "3:xxxxxxxx................oooooooo",    // Unknown side
+        "1-xxxxxxxx................oooooooo",    // Missing colon
+        "1:xxxxxxxx................ooooooo",     // Too short
+        "1:xxxxxxxx................ooooooooo",   // Too long
+        "1:xxxxxxxx........?.......oooooooo",    // Unknown piece
+    };
+    for (const auto& text : bad) {
+        EXPECT_FALSE(model.fromNotation(text)) << text;
+        EXPECT_EQ(model.toNotation(), STANDARD);
+    }
+}
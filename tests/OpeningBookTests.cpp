@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "MoveList.h"
+#include "OpeningBook.h"
+#include "SearchEngine.h"
+
+// OpeningBook Tests
+// Tests statistics collection, the book file and lookups from it
+class OpeningBookTests : public ::testing::Test {
+protected:
+    GameModel start;
+    std::string path;
+
+    void SetUp() override {
+        start.initializeStandardGame("Player1", "Player2");
+        path = (std::filesystem::temp_directory_path() / "thai_checkers_opening_book_test.book").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    // The first moves of the generator's order, one per ply
+    std::vector<Move> line(const std::vector<int>& choices) {
+        GameModel model(start);
+        std::vector<Move> moves;
+        for (int choice : choices) {
+            MoveList legal;
+            model.generateMoves(legal);
+            moves.push_back(model.toMove(legal[choice]));
+            model.makeMove(legal[choice]);
+        }
+        return moves;
+    }
+};
+
+TEST_F(OpeningBookTests, CollectsMoveStatistics) {
+    OpeningBookBuilder builder(4);
+    builder.addGame(start, line({0, 0, 0, 0, 0}), 0);
+    builder.addGame(start, line({0, 1, 0}), 1);
+    builder.addGame(start, line({2, 0}), NO_SIDE);
+
+    EXPECT_EQ(builder.gameCount(), 3u);
+    // Plies kept: 4 + 3 + 2, less the shared first move of games one and two
+    EXPECT_EQ(builder.size(), 8u);
+    ASSERT_TRUE(builder.write(path));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    EXPECT_EQ(book.size(), 8u);
+
+    std::vector<BookEntry> root = book.lookup(start.getHash());
+    ASSERT_EQ(root.size(), 2u);
+    EXPECT_LT(root[0].move, root[1].move);
+
+    const BookEntry& first = start.encodeMove(line({0})[0]).raw() == root[0].move ? root[0] : root[1];
+    EXPECT_EQ(first.plays, 2u);
+    EXPECT_EQ(first.wins, 1u);
+    EXPECT_EQ(first.losses, 1u);
+    EXPECT_EQ(first.draws(), 0u);
+}
+
+TEST_F(OpeningBookTests, ProbeReturnsMostPlayedMove) {
+    OpeningBookBuilder builder;
+    builder.addGame(start, line({3}), 0);
+    builder.addGame(start, line({1}), 0);
+    builder.addGame(start, line({1}), 1);
+    builder.addGame(start, line({5}), 0);
+    ASSERT_TRUE(builder.write(path));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    Move move;
+    ASSERT_TRUE(book.probe(start, move));
+    EXPECT_EQ(start.encodeMove(move), start.encodeMove(line({1})[0]));
+}
+
+TEST_F(OpeningBookTests, ProbeBreaksTiesByScore) {
+    OpeningBookBuilder builder;
+    builder.addGame(start, line({2}), 1);
+    builder.addGame(start, line({4}), 0);
+    ASSERT_TRUE(builder.write(path));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    Move move;
+    ASSERT_TRUE(book.probe(start, move));
+    EXPECT_EQ(start.encodeMove(move), start.encodeMove(line({4})[0]));
+}
+
+TEST_F(OpeningBookTests, MinPlaysFiltersRareMoves) {
+    OpeningBookBuilder builder;
+    builder.addGame(start, line({0, 0}), 0);
+    builder.addGame(start, line({0, 1}), 0);
+    ASSERT_TRUE(builder.write(path, 2));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    EXPECT_EQ(book.size(), 1u);
+
+    GameModel after(start);
+    after.makeMove(start.encodeMove(line({0})[0]));
+    Move move;
+    EXPECT_FALSE(book.probe(after, move));
+    EXPECT_TRUE(book.lookup(after.getHash()).empty());
+}
+
+TEST_F(OpeningBookTests, StopsRecordingAtIllegalMove) {
+    std::vector<Move> moves = line({0});
+    moves.push_back(moves[0]);  // Same piece again: no longer legal
+
+    OpeningBookBuilder builder;
+    builder.addGame(start, moves, NO_SIDE);
+    EXPECT_EQ(builder.size(), 1u);
+}
+
+TEST_F(OpeningBookTests, RejectsInvalidFiles) {
+    OpeningBook book;
+    EXPECT_FALSE(book.open(path));
+
+    std::ofstream(path, std::ios::binary) << "not an opening book";
+    EXPECT_FALSE(book.open(path));
+    EXPECT_FALSE(book.isOpen());
+    EXPECT_EQ(book.size(), 0u);
+
+    Move move;
+    EXPECT_FALSE(book.probe(start, move));
+
+    // An entry count whose byte size wraps to the real body size
+    OpeningBookBuilder builder;
+    builder.addGame(start, line({0}), 0);
+    ASSERT_TRUE(builder.write(path));
+    BookHeader header;
+    std::ifstream(path, std::ios::binary).read(reinterpret_cast<char*>(&header), sizeof(header));
+    header.entries += uint64_t{1} << 61;
+    std::fstream(path, std::ios::binary | std::ios::in | std::ios::out)
+        .write(reinterpret_cast<const char*>(&header), sizeof(header));
+    EXPECT_FALSE(book.open(path));
+    EXPECT_FALSE(book.isOpen());
+}
+
+TEST_F(OpeningBookTests, SearchPlaysBookMove) {
+    OpeningBookBuilder builder;
+    builder.addGame(start, line({6}), 0);
+    ASSERT_TRUE(builder.write(path));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    SearchEngine engine(1);
+    engine.setOpeningBook(&book);
+    SearchLimits limits;
+    limits.maxDepth = 4;
+
+    SearchResult result = engine.search(start, limits);
+    EXPECT_TRUE(result.fromBook);
+    EXPECT_EQ(result.nodes, 0u);
+    EXPECT_EQ(start.encodeMove(result.bestMove), start.encodeMove(line({6})[0]));
+
+    // Out of book the engine searches as usual
+    GameModel after(start);
+    after.makeMove(start.encodeMove(result.bestMove));
+    result = engine.search(after, limits);
+    EXPECT_FALSE(result.fromBook);
+    EXPECT_EQ(result.depth, 4);
+}
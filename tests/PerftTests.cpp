@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "Perft.h"
+#include "GameModel.h"
+#include "Zobrist.h"
+
+// Perft Tests
+// Tests leaf counts of the move generator against known values
+class PerftTests : public ::testing::Test {
+protected:
+    GameModel model;
+    
+    // Reference count through the map-based API and clone()
+    uint64_t referenceCount(GameModel& node, int depth) {
+        if (depth == 0) return 1;
+        uint64_t nodes = 0;
+        for (const auto& [pos, moves] : node.getAllValidMoves()) {
+            for (const auto& move : moves) {
+                GameModel* child = node.clone();
+                child->executeMove(move);
+                nodes += referenceCount(*child, depth - 1);
+                delete child;
+            }
+        }
+        return nodes;
+    }
+};
+
+TEST_F(PerftTests, StandardOpeningCounts) {
+    model.initializeStandardGame("Player1", "Player2");
+    Perft perft;
+    
+    const uint64_t expected[] = {1, 7, 49, 392, 3136, 26592, 218695};
+    for (int depth = 0; depth <= 6; ++depth) {
+        EXPECT_EQ(perft.count(model, depth), expected[depth]) << "depth " << depth;
+    }
+}
+
+TEST_F(PerftTests, HashedMatchesUnhashed) {
+    model.initializeStandardGame("Player1", "Player2");
+    Perft plain;
+    Perft hashed(1);
+    EXPECT_TRUE(hashed.isHashed());
+    
+    for (int depth = 1; depth <= 7; ++depth) {
+        EXPECT_EQ(hashed.count(model, depth), plain.count(model, depth)) << "depth " << depth;
+    }
+}
+
+TEST_F(PerftTests, DivideSumsToTotal) {
+    model.initializeStandardGame("Player1", "Player2");
+    Perft perft;
+    
+    auto lines = perft.divide(model, 4);
+    ASSERT_EQ(lines.size(), 7u);
+    uint64_t total = 0;
+    for (const auto& line : lines) total += line.nodes;
+    EXPECT_EQ(total, 3136u);
+}
+
+TEST_F(PerftTests, DameEndgameMatchesReference) {
+    BitBoard position;
+    position.pieces[0] = (1u << squareIndex({1, 1})) | (1u << squareIndex({3, 5}));
+    position.pieces[1] = (1u << squareIndex({6, 2})) | (1u << squareIndex({4, 4})) | (1u << squareIndex({7, 7}));
+    position.dames = (1u << squareIndex({1, 1})) | (1u << squareIndex({7, 7}));
+    model.initializeFromBitBoard("Player1", "Player2", position, 0);
+    
+    Perft perft;
+    for (int depth = 1; depth <= 5; ++depth) {
+        EXPECT_EQ(perft.count(model, depth), referenceCount(model, depth)) << "depth " << depth;
+    }
+    EXPECT_TRUE(model.getBitBoard() == position);
+}
+
+TEST_F(PerftTests, ParallelMatchesSerial) {
+    model.initializeStandardGame("Player1", "Player2");
+    Perft serial;
+    Perft parallel(0, 4);
+    EXPECT_EQ(parallel.threadCount(), 4u);
+    
+    for (int depth = 1; depth <= 7; ++depth) {
+        EXPECT_EQ(parallel.count(model, depth), serial.count(model, depth)) << "depth " << depth;
+    }
+    EXPECT_TRUE(model.getHash() == zobristHash(model.getBitBoard(), model.getCurrentSide()));
+}
+
+TEST_F(PerftTests, ParallelHashedMatchesSerial) {
+    model.initializeStandardGame("Player1", "Player2");
+    Perft serial;
+    Perft parallel(1, 3);
+    
+    EXPECT_EQ(parallel.count(model, 7), serial.count(model, 7));
+    EXPECT_EQ(parallel.count(model, 7), 1820189u);
+}
+
+TEST_F(PerftTests, ParallelDivideMatchesSerial) {
+    model.initializeStandardGame("Player1", "Player2");
+    Perft serial;
+    Perft parallel(0, 4);
+    
+    auto expected = serial.divide(model, 6);
+    auto lines = parallel.divide(model, 6);
+    ASSERT_EQ(lines.size(), expected.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_TRUE(lines[i].move.from == expected[i].move.from);
+        EXPECT_TRUE(lines[i].move.path == expected[i].move.path);
+        EXPECT_EQ(lines[i].nodes, expected[i].nodes);
+    }
+}
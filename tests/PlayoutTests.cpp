@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "Playout.h"
+#include "GameModel.h"
+#include "TestPositions.h"
+
+// Playout Tests
+// Tests the random playout kernel against GameModel and its generator
+class PlayoutTests : public ::testing::Test {
+protected:
+    GameModel model;
+
+    void SetUp() override {
+        model.initializeStandardGame("Player1", "Player2");
+    }
+
+    // The same game played through generateMoves and makeMove
+    static PlayoutResult referencePlayout(GameModel position, Xoshiro256& rng, int maxPlies) {
+        PlayoutResult result;
+        MoveList moves;
+        for (; result.plies < maxPlies; ++result.plies) {
+            position.generateMoves(moves);
+            if (moves.empty()) {
+                result.winner = 1 - position.getCurrentSide();
+                return result;
+            }
+            position.makeMove(moves[static_cast<int>(rng.below(static_cast<uint32_t>(moves.size())))]);
+        }
+        return result;
+    }
+
+    void expectSameGames(const GameModel& start, int games) {
+        for (int seed = 1; seed <= games; ++seed) {
+            Xoshiro256 kernelRng(seed);
+            Xoshiro256 referenceRng(seed);
+            PlayoutResult kernel = randomPlayout(start, kernelRng, 200);
+            PlayoutResult reference = referencePlayout(start, referenceRng, 200);
+            ASSERT_EQ(kernel.winner, reference.winner) << "seed " << seed;
+            ASSERT_EQ(kernel.plies, reference.plies) << "seed " << seed;
+            EXPECT_EQ(kernelRng.next(), referenceRng.next()) << "seed " << seed;
+        }
+    }
+};
+
+TEST_F(PlayoutTests, MatchesGameModelFromStart) {
+    expectSameGames(model, 300);
+}
+
+TEST_F(PlayoutTests, MatchesGameModelWithDames) {
+    // Dames on long diagonals with chained captures available
+    setUpPosition(model, "1:X.....x..x...o.....o..o..o.....O");
+    expectSameGames(model, 300);
+
+    setUpPosition(model, "2:...X......x.........o........O..");
+    expectSameGames(model, 100);
+}
+
+TEST_F(PlayoutTests, SideWithoutMovesLoses) {
+    setUpPosition(model, "2:.........x......................");
+    Xoshiro256 rng(1);
+    PlayoutResult result = randomPlayout(model, rng);
+    EXPECT_EQ(result.winner, 0);
+    EXPECT_EQ(result.plies, 0);
+
+    // Taking the last piece ends the game after one ply
+    setUpPosition(model, "1:.........x...o..................");
+    result = randomPlayout(model, rng);
+    EXPECT_EQ(result.winner, 0);
+    EXPECT_EQ(result.plies, 1);
+}
+
+TEST_F(PlayoutTests, PlyLimitIsDraw) {
+    Xoshiro256 rng(3);
+    PlayoutResult result = randomPlayout(model, rng, 6);
+    EXPECT_EQ(result.winner, NO_SIDE);
+    EXPECT_EQ(result.plies, 6);
+
+    result = randomPlayout(model, rng, 0);
+    EXPECT_EQ(result.winner, NO_SIDE);
+    EXPECT_EQ(result.plies, 0);
+}
+
+TEST_F(PlayoutTests, GeneratorIsSeededAndBounded) {
+    Xoshiro256 a(42);
+    Xoshiro256 b(42);
+    Xoshiro256 c(43);
+    int differences = 0;
+    for (int i = 0; i < 100; ++i) {
+        uint64_t value = a.next();
+        EXPECT_EQ(value, b.next());
+        differences += value != c.next();
+    }
+    EXPECT_GT(differences, 95);
+
+    int seen[7] = {};
+    for (int i = 0; i < 7000; ++i) {
+        uint32_t value = a.below(7);
+        ASSERT_LT(value, 7u);
+        ++seen[value];
+    }
+    for (int count : seen) EXPECT_GT(count, 800);
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include "SearchEngine.h"
+#include "Evaluation.h"
+#include "GameModel.h"
+#include "TestPositions.h"
+
+// SearchEngine Tests
+// Tests best-move selection, scoring, budgets and principal variations
+class SearchEngineTests : public ::testing::Test {
+protected:
+    GameModel model;
+    SearchEngine engine{1};
+};
+
+TEST_F(SearchEngineTests, ReturnsLegalMoveFromOpening) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchLimits limits;
+    limits.maxDepth = 5;
+    
+    SearchResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_TRUE(isLegalMove(model, result.bestMove));
+    EXPECT_EQ(result.depth, 5);
+    EXPECT_GT(result.nodes, 0u);
+}
+
+TEST_F(SearchEngineTests, LeavesModelUnchanged) {
+    model.initializeStandardGame("Player1", "Player2");
+    BitBoard before = model.getBitBoard();
+    uint64_t hash = model.getHash();
+    
+    SearchLimits limits;
+    limits.maxDepth = 4;
+    engine.search(model, limits);
+    EXPECT_TRUE(model.getBitBoard() == before);
+    EXPECT_EQ(model.getHash(), hash);
+    EXPECT_EQ(model.getCurrentSide(), 0);
+}
+
+TEST_F(SearchEngineTests, PrefersCapturingDame) {
+    // Pion at (2,2) can take the Pion on (3,1) or the Dame on (3,3)
+    setUpPosition(model, "1:.........x..oO.................o");
+    SearchLimits limits;
+    limits.maxDepth = 1;
+    
+    SearchResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    ASSERT_EQ(result.bestMove.captured.size(), 1u);
+    EXPECT_EQ(result.bestMove.captured[0], Position(3, 3));
+}
+
+TEST_F(SearchEngineTests, ScoresWinningCaptureAsMate) {
+    // Taking the last opposing piece wins at once
+    setUpPosition(model, "1:.........x...o..................");
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    
+    SearchResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_EQ(result.score, SearchEngine::MATE_SCORE - 1);
+    EXPECT_TRUE(SearchEngine::isMateScore(result.score));
+}
+
+TEST_F(SearchEngineTests, NoMovesIsLost) {
+    // Player2's only Pion is blocked and cannot jump the guarded Pion
+    setUpPosition(model, "2:......................x....x...o");
+    
+    SearchResult result = engine.search(model, SearchLimits());
+    EXPECT_FALSE(result.hasMove());
+    EXPECT_EQ(result.score, -SearchEngine::MATE_SCORE);
+}
+
+TEST_F(SearchEngineTests, RespectsNodeBudget) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchLimits limits;
+    limits.maxNodes = 5000;
+    
+    SearchResult result = engine.search(model, limits);
+    EXPECT_LE(result.nodes, 5000u);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_TRUE(isLegalMove(model, result.bestMove));
+}
+
+TEST_F(SearchEngineTests, RespectsTimeBudget) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchLimits limits;
+    limits.maxTimeMs = 50;
+    
+    SearchResult result = engine.search(model, limits);
+    EXPECT_LT(result.seconds, 1.0);
+    EXPECT_TRUE(result.hasMove());
+}
+
+TEST_F(SearchEngineTests, PrincipalVariationIsPlayable) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    
+    SearchResult result = engine.search(model, limits);
+    ASSERT_FALSE(result.pv.empty());
+    EXPECT_EQ(result.pv.front().from, result.bestMove.from);
+    EXPECT_TRUE(result.pv.front().path == result.bestMove.path);
+    
+    GameModel line = model;
+    for (const auto& move : result.pv) {
+        ASSERT_TRUE(isLegalMove(line, move));
+        line.executeMove(move);
+    }
+}
+
+TEST_F(SearchEngineTests, SearchIsRepeatable) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    
+    SearchResult first = engine.search(model, limits);
+    engine.clearHash();
+    SearchResult second = engine.search(model, limits);
+    EXPECT_EQ(first.score, second.score);
+    EXPECT_EQ(first.nodes, second.nodes);
+    EXPECT_TRUE(first.bestMove.path == second.bestMove.path);
+}
+
+TEST_F(SearchEngineTests, SingleThreadIsDeterministic) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchLimits limits;
+    limits.maxDepth = 7;
+    
+    SearchEngine first(1, 1);
+    SearchEngine second(1, 1);
+    SearchResult a = first.search(model, limits);
+    SearchResult b = second.search(model, limits);
+    EXPECT_EQ(a.score, b.score);
+    EXPECT_EQ(a.nodes, b.nodes);
+    ASSERT_EQ(a.pv.size(), b.pv.size());
+    for (size_t i = 0; i < a.pv.size(); ++i) {
+        EXPECT_TRUE(a.pv[i].path == b.pv[i].path);
+    }
+}
+
+TEST_F(SearchEngineTests, LazySmpReturnsLegalMove) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchEngine parallel(4, 4);
+    EXPECT_EQ(parallel.threadCount(), 4u);
+    
+    SearchLimits limits;
+    limits.maxDepth = 7;
+    SearchResult result = parallel.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_TRUE(isLegalMove(model, result.bestMove));
+    EXPECT_EQ(result.depth, 7);
+    
+    GameModel line = model;
+    for (const auto& move : result.pv) {
+        ASSERT_TRUE(isLegalMove(line, move));
+        line.executeMove(move);
+    }
+}
+
+TEST_F(SearchEngineTests, LazySmpAgreesOnForcedWin) {
+    setUpPosition(model, "1:.........x...o..................");
+    SearchEngine parallel(1, 3);
+    SearchLimits limits;
+    limits.maxDepth = 6;
+    
+    SearchResult result = parallel.search(model, limits);
+    EXPECT_EQ(result.score, SearchEngine::MATE_SCORE - 1);
+}
+
+TEST_F(SearchEngineTests, LazySmpRespectsNodeBudget) {
+    model.initializeStandardGame("Player1", "Player2");
+    SearchEngine parallel(1, 3);
+    SearchLimits limits;
+    limits.maxNodes = 20000;
+    
+    SearchResult result = parallel.search(model, limits);
+    EXPECT_TRUE(result.hasMove());
+    // Helpers publish their counts in batches, so allow one batch each
+    EXPECT_LE(result.nodes, 20000u + 3 * 1024u);
+}
+
+TEST_F(SearchEngineTests, QuiescenceResolvesExchange) {
+    // (2,2) must take (3,3) and is then retaken from (5,5); a search that
+    // stopped after the first capture would score it as level
+    setUpPosition(model, "1:...x.....x...o........o....o....");
+    SearchLimits limits;
+    limits.maxDepth = 1;
+    
+    SearchResult result = engine.search(model, limits);
+    ASSERT_GE(result.pv.size(), 2u);
+    EXPECT_TRUE(result.pv[0].isCapture());
+    EXPECT_TRUE(result.pv[1].isCapture());
+    
+    // Scored as the quiet position after both captures, a Pion down
+    GameModel settled = model;
+    settled.executeMove(result.pv[0]);
+    settled.executeMove(result.pv[1]);
+    EXPECT_EQ(result.score, Evaluation::evaluate(settled));
+    EXPECT_LT(result.score, 0);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <sstream>
+#include "SelfPlay.h"
+
+// SelfPlay Tests
+// Tests policies, reproducibility across thread counts and record output
+class SelfPlayTests : public ::testing::Test {
+protected:
+    SelfPlayConfig config;
+
+    void SetUp() override {
+        config.games = 40;
+        config.seed = 7;
+        config.maxPlies = 120;
+        config.threads = 1;
+    }
+
+    std::vector<GameRecord> collect(SelfPlayRunner& runner) {
+        std::vector<GameRecord> records;
+        runner.run(config, [&](const GameRecord& record) { records.push_back(record); });
+        return records;
+    }
+
+    static bool sameMoves(const GameRecord& a, const GameRecord& b) {
+        if (a.moves.size() != b.moves.size()) return false;
+        for (size_t i = 0; i < a.moves.size(); ++i) {
+            if (a.moves[i] != b.moves[i]) return false;
+        }
+        return true;
+    }
+};
+
+TEST_F(SelfPlayTests, GamesAreLegalAndScored) {
+    SelfPlayRunner runner(makePolicyFactory("random"), makePolicyFactory("random"));
+    std::vector<GameRecord> records = collect(runner);
+    ASSERT_EQ(records.size(), 40u);
+
+    for (size_t i = 0; i < records.size(); ++i) {
+        const GameRecord& record = records[i];
+        EXPECT_EQ(record.index, i);
+
+        GameModel model;
+        model.initializeStandardGame("Player1", "Player2");
+        for (const auto& move : record.moves) {
+            MoveList legal;
+            model.generateMoves(legal);
+            bool found = false;
+            for (const auto& entry : legal) found = found || model.encodeMove(entry) == move;
+            ASSERT_TRUE(found) << "game " << i;
+            model.makeMove(move);
+        }
+
+        MoveList remaining;
+        model.generateMoves(remaining);
+        if (record.winner == NO_SIDE) {
+            EXPECT_EQ(record.moves.size(), 120u);
+        } else {
+            EXPECT_TRUE(remaining.empty());
+            EXPECT_EQ(record.winner, 1 - model.getCurrentSide());
+        }
+    }
+}
+
+TEST_F(SelfPlayTests, SameSeedSameGamesOnAnyThreadCount) {
+    SelfPlayRunner runner(makePolicyFactory("random"), makePolicyFactory("first"));
+    std::vector<GameRecord> serial = collect(runner);
+
+    config.threads = 4;
+    std::vector<GameRecord> parallel = collect(runner);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_EQ(parallel[i].index, i);
+        EXPECT_EQ(parallel[i].winner, serial[i].winner);
+        EXPECT_TRUE(sameMoves(parallel[i], serial[i])) << "game " << i;
+    }
+}
+
+TEST_F(SelfPlayTests, BoundsGamesInFlight) {
+    // playGame makes one policy per side, so every game started shows up here
+    std::atomic<uint64_t> policies{0};
+    PolicyFactory counted = [&policies]() {
+        ++policies;
+        return std::make_unique<FirstLegalPolicy>();
+    };
+    SelfPlayRunner runner(counted, counted);
+    config.games = 2000;
+    config.maxPlies = 10;
+    config.threads = 4;
+
+    uint64_t delivered = 0;
+    bool withinBound = true;
+    runner.run(config, [&](const GameRecord& record) {
+        if (record.index != delivered || policies.load() / 2 > delivered + SelfPlayRunner::WINDOW_SIZE) {
+            withinBound = false;
+        }
+        ++delivered;
+    });
+    EXPECT_TRUE(withinBound);
+    EXPECT_EQ(delivered, config.games);
+    EXPECT_EQ(policies.load(), 2 * config.games);
+}
+
+TEST_F(SelfPlayTests, SeedsChangeGames) {
+    SelfPlayRunner runner(makePolicyFactory("random"), makePolicyFactory("random"));
+    std::vector<GameRecord> first = collect(runner);
+    config.seed = 8;
+    std::vector<GameRecord> second = collect(runner);
+
+    int different = 0;
+    for (size_t i = 0; i < first.size(); ++i) different += sameMoves(first[i], second[i]) ? 0 : 1;
+    EXPECT_GT(different, 30);
+
+    // Games within one run differ too
+    EXPECT_FALSE(sameMoves(first[0], first[1]));
+}
+
+TEST_F(SelfPlayTests, FirstLegalPolicyIsDeterministic) {
+    SelfPlayRunner runner(makePolicyFactory("first"), makePolicyFactory("first"));
+    config.games = 3;
+    std::vector<GameRecord> records = collect(runner);
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_TRUE(sameMoves(records[0], records[1]));
+    EXPECT_TRUE(sameMoves(records[0], records[2]));
+
+    GameModel model;
+    model.initializeStandardGame("Player1", "Player2");
+    MoveList legal;
+    model.generateMoves(legal);
+    EXPECT_EQ(records[0].moves[0], model.encodeMove(legal[0]));
+}
+
+TEST_F(SelfPlayTests, SearchPolicyBeatsRandom) {
+    SearchLimits limits;
+    limits.maxDepth = 2;
+    SelfPlayRunner runner(makePolicyFactory("search", limits), makePolicyFactory("random"));
+    config.games = 6;
+    config.maxPlies = 200;
+
+    SelfPlayRunner::Summary summary = runner.run(config, nullptr);
+    EXPECT_EQ(summary.games, 6u);
+    EXPECT_GE(summary.wins[0], 5u);
+}
+
+TEST_F(SelfPlayTests, SummaryCountsResults) {
+    SelfPlayRunner runner(makePolicyFactory("random"), makePolicyFactory("random"));
+    std::vector<GameRecord> records;
+    SelfPlayRunner::Summary summary = runner.run(config, [&](const GameRecord& r) { records.push_back(r); });
+
+    uint64_t plies = 0;
+    for (const auto& record : records) plies += record.moves.size();
+    EXPECT_EQ(summary.games, 40u);
+    EXPECT_EQ(summary.wins[0] + summary.wins[1] + summary.draws, 40u);
+    EXPECT_EQ(summary.plies, plies);
+}
+
+TEST_F(SelfPlayTests, UnknownPolicyHasNoFactory) {
+    EXPECT_FALSE(makePolicyFactory("minimax"));
+    EXPECT_TRUE(makePolicyFactory("search"));
+}
+
+TEST_F(SelfPlayTests, WritesOneLinePerGame) {
+    GameRecord record;
+    record.index = 12;
+    record.winner = 1;
+    record.moves.push_back(CompactMove::make(5, 9, 0, false));
+    record.moves.push_back(CompactMove::make(9, 18, 1u << 13, false));
+
+    std::ostringstream out;
+    SelfPlayRunner::write(out, record);
+    EXPECT_EQ(out.str(), "12 0-1 2 5-9 9x18\n");
+}
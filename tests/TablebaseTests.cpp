@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include "MoveList.h"
+#include "SearchEngine.h"
+#include "Tablebase.h"
+#include "TablebaseGenerator.h"
+#include "TestPositions.h"
+
+// Tablebase Tests
+// Tests the position index, the generated tables against the move rules,
+// and probing through memory-mapped files
+class TablebaseTests : public ::testing::Test {
+protected:
+    static constexpr int MAX_PIECES = 3;
+
+    static std::string directory;
+    static Tablebase tables;
+
+    // Tables are generated once for the whole suite
+    static void SetUpTestSuite() {
+        directory = (std::filesystem::temp_directory_path() / "thai_checkers_tablebase_tests").string();
+        std::filesystem::remove_all(directory);
+        TablebaseGenerator generator;
+        ASSERT_TRUE(generator.generate(MAX_PIECES, directory));
+        tables.open(directory);
+    }
+
+    static void TearDownTestSuite() {
+        tables.close();
+        std::filesystem::remove_all(directory);
+    }
+
+    static Material material(int p0, int d0, int p1, int d1) {
+        Material result;
+        result.pions[0] = p0;
+        result.dames[0] = d0;
+        result.pions[1] = p1;
+        result.dames[1] = d1;
+        return result;
+    }
+
+    // Value of a position reached by a move, from its side to move
+    static bool childValue(const BitBoard& board, int side, Tablebase::Result& result) {
+        if (board.pieces[side] == 0) {
+            result.outcome = Tablebase::Outcome::Loss;
+            result.distance = 0;
+            return true;
+        }
+        return tables.probe(board, side, result);
+    }
+};
+
+std::string TablebaseTests::directory;
+Tablebase TablebaseTests::tables;
+
+TEST_F(TablebaseTests, IndexRoundTrip) {
+    Material mixed = material(1, 1, 1, 0);
+    uint64_t size = TablebaseIndex::size(mixed);
+    EXPECT_EQ(size, 32u * 31u * 30u * 2u);
+
+    for (uint64_t index = 0; index < size; ++index) {
+        BitBoard board;
+        int side;
+        TablebaseIndex::position(mixed, index, board, side);
+        ASSERT_TRUE(Material::of(board) == mixed) << "index " << index;
+        ASSERT_EQ(TablebaseIndex::index(board, side), index);
+    }
+}
+
+TEST_F(TablebaseTests, MaterialsInSolvingOrder) {
+    std::vector<Material> order = TablebaseGenerator::materials(MAX_PIECES);
+    ASSERT_EQ(order.size(), 16u);
+
+    // Captures lose a piece and promotions a Pion, so both lead backwards
+    for (size_t i = 1; i < order.size(); ++i) {
+        const Material& previous = order[i - 1];
+        const Material& current = order[i];
+        EXPECT_TRUE(previous.total() < current.total() ||
+                    (previous.total() == current.total() &&
+                     previous.pions[0] + previous.pions[1] <= current.pions[0] + current.pions[1]));
+    }
+}
+
+TEST_F(TablebaseTests, RejectsMaterialsTooLargeToIndex) {
+    uint64_t largest7 = 0;
+    for (const auto& candidate : TablebaseGenerator::materials(TablebaseGenerator::MAX_PIECES)) {
+        largest7 = std::max(largest7, TablebaseIndex::size(candidate));
+    }
+    EXPECT_LE(largest7, TablebaseGenerator::MAX_MATERIAL_SIZE);
+
+    // The largest 8-piece Material can't be solved, and nothing is allocated trying
+    Material large;
+    for (const auto& candidate : TablebaseGenerator::materials(TablebaseGenerator::MAX_PIECES + 1)) {
+        if (TablebaseIndex::size(candidate) > TablebaseIndex::size(large)) large = candidate;
+    }
+    ASSERT_GT(TablebaseIndex::size(large), TablebaseGenerator::MAX_MATERIAL_SIZE);
+    TablebaseGenerator generator;
+    EXPECT_TRUE(generator.solve(large).empty());
+    EXPECT_FALSE(generator.isSolved(large));
+}
+
+TEST_F(TablebaseTests, OpensEveryTable) {
+    EXPECT_EQ(tables.tableCount(), 16u);
+    EXPECT_EQ(tables.maxPieces(), MAX_PIECES);
+    EXPECT_TRUE(tables.hasTable(material(0, 2, 0, 1)));
+    EXPECT_TRUE(std::filesystem::exists(std::filesystem::path(directory) / "x0X2o0O1.tb"));
+}
+
+TEST_F(TablebaseTests, ValuesAgreeWithMoveRules) {
+    for (const auto& mat : TablebaseGenerator::materials(MAX_PIECES)) {
+        uint64_t size = TablebaseIndex::size(mat);
+        for (uint64_t index = 0; index < size; index += 3) {
+            BitBoard board;
+            int side;
+            TablebaseIndex::position(mat, index, board, side);
+            if (!TablebaseIndex::isReachable(board)) continue;
+
+            Tablebase::Result result;
+            ASSERT_TRUE(tables.probe(board, side, result));
+
+            GameModel model;
+            model.initializeFromBitBoard("Player1", "Player2", board, side);
+            MoveList moves;
+            model.generateMoves(moves);
+
+            bool anyDraw = false;
+            int quickestLoss = -1;
+            int longestWin = -1;
+            for (const auto& entry : moves) {
+                GameModel::UndoInfo undo = model.makeMove(entry);
+                Tablebase::Result child;
+                ASSERT_TRUE(childValue(model.getBitBoard(), 1 - side, child));
+                model.unmakeMove(undo);
+
+                if (child.outcome == Tablebase::Outcome::Loss) {
+                    if (quickestLoss < 0 || child.distance < quickestLoss) quickestLoss = child.distance;
+                } else if (child.outcome == Tablebase::Outcome::Win) {
+                    longestWin = std::max(longestWin, child.distance);
+                } else {
+                    anyDraw = true;
+                }
+            }
+
+            if (quickestLoss >= 0) {
+                ASSERT_EQ(result.outcome, Tablebase::Outcome::Win) << mat.fileName() << " index " << index;
+                ASSERT_EQ(result.distance, quickestLoss + 1) << mat.fileName() << " index " << index;
+            } else if (moves.empty()) {
+                ASSERT_EQ(result.outcome, Tablebase::Outcome::Loss) << mat.fileName() << " index " << index;
+                ASSERT_EQ(result.distance, 0);
+            } else if (anyDraw) {
+                ASSERT_EQ(result.outcome, Tablebase::Outcome::Draw) << mat.fileName() << " index " << index;
+            } else {
+                ASSERT_EQ(result.outcome, Tablebase::Outcome::Loss) << mat.fileName() << " index " << index;
+                ASSERT_EQ(result.distance, longestWin + 1) << mat.fileName() << " index " << index;
+            }
+        }
+    }
+}
+
+TEST_F(TablebaseTests, DameCapturesLastPiece) {
+    BitBoard board;
+    board.pieces[0] = squareBit(Position(2, 2));
+    board.pieces[1] = squareBit(Position(4, 4));
+    board.dames = board.pieces[0];
+
+    Tablebase::Result result;
+    ASSERT_TRUE(tables.probe(board, 0, result));
+    EXPECT_EQ(result.outcome, Tablebase::Outcome::Win);
+    EXPECT_EQ(result.distance, 1);
+}
+
+TEST_F(TablebaseTests, BlockedSideHasLost) {
+    // Player2's Pion at (1,1) is blocked by Player1 Pions it can't jump
+    BitBoard board;
+    board.pieces[0] = squareBit(Position(0, 0)) | squareBit(Position(0, 2));
+    board.pieces[1] = squareBit(Position(1, 1));
+
+    Tablebase::Result result;
+    ASSERT_TRUE(tables.probe(board, 1, result));
+    EXPECT_EQ(result.outcome, Tablebase::Outcome::Loss);
+    EXPECT_EQ(result.distance, 0);
+}
+
+TEST_F(TablebaseTests, MissingTablesAreNotProbed) {
+    GameModel model;
+    model.initializeStandardGame("Player1", "Player2");
+    Tablebase::Result result;
+    EXPECT_FALSE(tables.probe(model, result));
+
+    Tablebase empty;
+    EXPECT_EQ(empty.open(directory + "_missing"), 0);
+    EXPECT_EQ(empty.maxPieces(), 0);
+}
+
+TEST_F(TablebaseTests, SkipsInvalidFiles) {
+    std::string invalid = directory + "_invalid";
+    std::filesystem::create_directories(invalid);
+    std::ofstream(std::filesystem::path(invalid) / "x0X1o0O1.tb") << "not a table";
+
+    // Counts that overflow the Material key and index nothing
+    TablebaseHeader header{};
+    std::copy(Tablebase::MAGIC, Tablebase::MAGIC + sizeof(Tablebase::MAGIC), header.magic);
+    header.version = Tablebase::VERSION;
+    header.pions[0] = 16;
+    header.pions[1] = 16;
+    header.dames[1] = 1;
+    std::ofstream(std::filesystem::path(invalid) / "x16X0o16O1.tb", std::ios::binary)
+        .write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // A valid table under another material's name
+    std::filesystem::copy_file(std::filesystem::path(directory) / "x0X1o0O1.tb",
+                               std::filesystem::path(invalid) / "x0X2o0O1.tb");
+
+    Tablebase other;
+    EXPECT_EQ(other.open(invalid), 0);
+    EXPECT_EQ(other.maxPieces(), 0);
+    std::filesystem::remove_all(invalid);
+}
+
+TEST_F(TablebaseTests, MappedFileReadsWholeFile) {
+    std::string path = (std::filesystem::path(directory) / "x0X1o0O1.tb").string();
+    MappedFile file;
+    ASSERT_TRUE(file.open(path));
+    EXPECT_EQ(file.size(), sizeof(TablebaseHeader) + TablebaseIndex::size(material(0, 1, 0, 1)));
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(file.data()), 4), "TCTB");
+
+    MappedFile moved(std::move(file));
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(moved.isOpen());
+
+    EXPECT_FALSE(file.open(directory + "/missing.tb"));
+}
+
+TEST_F(TablebaseTests, SearchUsesTablebaseScores) {
+    // Two Dames against one: find a tabled win that takes several plies
+    Material mat = material(0, 2, 0, 1);
+    BitBoard board;
+    int side = 0;
+    Tablebase::Result expected;
+    for (uint64_t index = 0; index < TablebaseIndex::size(mat); index += 2) {
+        TablebaseIndex::position(mat, index, board, side);
+        if (tables.probe(board, side, expected) && expected.outcome == Tablebase::Outcome::Win &&
+            expected.distance >= 5) {
+            break;
+        }
+    }
+    ASSERT_EQ(expected.outcome, Tablebase::Outcome::Win);
+    ASSERT_GE(expected.distance, 5);
+
+    GameModel model;
+    model.initializeFromBitBoard("Player1", "Player2", board, side);
+    SearchEngine engine(1);
+    engine.setTablebase(&tables);
+    SearchLimits limits;
+    limits.maxDepth = 2;
+
+    SearchResult result = engine.search(model, limits);
+    ASSERT_TRUE(result.hasMove());
+    EXPECT_EQ(result.score, SearchEngine::MATE_SCORE - expected.distance);
+}
@@ -0,0 +1,45 @@
+#ifndef TESTPOSITIONS_H
+#define TESTPOSITIONS_H
+
+#include <gtest/gtest.h>
+#include <string>
+#include "GameModel.h"
+#include "MoveList.h"
+
+// Position helpers shared by the test fixtures. New fixtures should set up
+// positions from notation strings (see GameModel::toNotation).
+
+// Mask of one dark square
+inline uint32_t squareBit(Position pos) {
+    return 1u << squareIndex(pos);
+}
+
+// Fails the calling test when the notation doesn't parse
+inline void setUpPosition(GameModel& model, const std::string& notation) {
+    ASSERT_TRUE(model.fromNotation(notation)) << notation;
+}
+
+// Whether the move is one of the legal moves of its piece in the position
+inline bool isLegalMove(const GameModel& model, const Move& move) {
+    for (const auto& candidate : model.getValidMoves(move.from)) {
+        if (candidate.path == move.path) return true;
+    }
+    return false;
+}
+
+// Plays a deterministic game with executeMove from the model's position,
+// a different one for each seed. visit(moves, ply) sees every position
+// reached, with its legal moves, before the next move is played; the walk
+// ends at a position without moves or after maxPlies moves.
+template <typename Visit>
+void walkGame(GameModel& model, int maxPlies, int seed, Visit visit) {
+    MoveList moves;
+    for (int ply = 0; ; ++ply) {
+        model.generateMoves(moves);
+        visit(static_cast<const MoveList&>(moves), ply);
+        if (moves.empty() || ply == maxPlies) return;
+        model.executeMove(model.toMove(moves[(ply * 7 + seed) % moves.size()]));
+    }
+}
+
+#endif // TESTPOSITIONS_H
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include "ThreadPool.h"
+
+// ThreadPool Tests
+// Tests task execution, nested fork-join and group completion
+class ThreadPoolTests : public ::testing::Test {
+protected:
+    // Recursive fork-join sum of 1..n, each level waiting on its own group
+    static uint64_t forkSum(ThreadPool& pool, uint64_t low, uint64_t high) {
+        if (high - low < 16) {
+            uint64_t sum = 0;
+            for (uint64_t value = low; value <= high; ++value) sum += value;
+            return sum;
+        }
+        uint64_t middle = (low + high) / 2;
+        uint64_t left = 0;
+        uint64_t right = 0;
+        ThreadPool::TaskGroup group;
+        pool.submit(group, [&]() { left = forkSum(pool, low, middle); });
+        pool.submit(group, [&]() { right = forkSum(pool, middle + 1, high); });
+        pool.wait(group);
+        return left + right;
+    }
+};
+
+TEST_F(ThreadPoolTests, RunsEveryTask) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    
+    std::atomic<int> counter{0};
+    ThreadPool::TaskGroup group;
+    for (int i = 0; i < 1000; ++i) {
+        pool.submit(group, [&counter]() { counter.fetch_add(1); });
+    }
+    pool.wait(group);
+    EXPECT_TRUE(group.done());
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST_F(ThreadPoolTests, NestedGroupsComplete) {
+    ThreadPool pool(3);
+    EXPECT_EQ(forkSum(pool, 1, 10000), 10000ull * 10001 / 2);
+}
+
+TEST_F(ThreadPoolTests, SingleWorkerHandlesNesting) {
+    ThreadPool pool(1);
+    EXPECT_EQ(forkSum(pool, 1, 2000), 2000ull * 2001 / 2);
+}
+
+TEST_F(ThreadPoolTests, ResultsLandInOrder) {
+    ThreadPool pool(4);
+    std::vector<int> results(200, -1);
+    ThreadPool::TaskGroup group;
+    for (int i = 0; i < 200; ++i) {
+        pool.submit(group, [&results, i]() { results[i] = i * i; });
+    }
+    pool.wait(group);
+    for (int i = 0; i < 200; ++i) EXPECT_EQ(results[i], i * i);
+}
+
+TEST_F(ThreadPoolTests, EmptyGroupIsDone) {
+    ThreadPool pool(2);
+    ThreadPool::TaskGroup group;
+    EXPECT_TRUE(group.done());
+    pool.wait(group);
+}
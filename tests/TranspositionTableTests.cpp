@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "TranspositionTable.h"
+#include "GameModel.h"
+#include <thread>
+#include <vector>
+
+// Transposition Table Tests
+// Tests storage, replacement, statistics and lock-free concurrent access
+class TranspositionTableTests : public ::testing::Test {
+protected:
+    TranspositionTable table{1};
+    
+    using Bound = TranspositionTable::Bound;
+    
+    // Keys that all land in bucket 0
+    uint64_t bucketKey(uint64_t n) const {
+        return n * table.capacity();
+    }
+};
+
+TEST_F(TranspositionTableTests, StoreAndProbe) {
+    GameModel model;
+    model.initializeStandardGame("Player1", "Player2");
+    MoveList moves;
+    model.generateMoves(moves);
+    CompactMove best = model.encodeMove(moves[2]);
+    
+    TranspositionTable::Entry entry;
+    EXPECT_FALSE(table.probe(model.getHash(), entry));
+    
+    table.store(model.getHash(), 6, -125, Bound::Lower, best);
+    ASSERT_TRUE(table.probe(model.getHash(), entry));
+    EXPECT_EQ(entry.depth, 6);
+    EXPECT_EQ(entry.score, -125);
+    EXPECT_EQ(entry.bound, Bound::Lower);
+    EXPECT_EQ(entry.bestMove, best);
+    
+    auto stats = table.getStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.stores, 1u);
+    EXPECT_EQ(stats.collisions, 0u);
+}
+
+TEST_F(TranspositionTableTests, SamePositionKeepsBestMove) {
+    CompactMove best = CompactMove::make(9, 13, 0, false);
+    table.store(42, 3, 10, Bound::Exact, best);
+    table.store(42, 5, 20, Bound::Upper, CompactMove());
+    
+    TranspositionTable::Entry entry;
+    ASSERT_TRUE(table.probe(42, entry));
+    EXPECT_EQ(entry.depth, 5);
+    EXPECT_EQ(entry.bestMove, best);
+}
+
+TEST_F(TranspositionTableTests, ReplacesShallowestAndOldest) {
+    // Fill one bucket, then store a fifth position
+    for (uint64_t i = 1; i <= 4; ++i) {
+        table.store(bucketKey(i), static_cast<int>(i) * 2, 0, Bound::Exact, CompactMove());
+    }
+    table.store(bucketKey(5), 10, 0, Bound::Exact, CompactMove());
+    
+    TranspositionTable::Entry entry;
+    EXPECT_FALSE(table.probe(bucketKey(1), entry));
+    EXPECT_TRUE(table.probe(bucketKey(2), entry));
+    EXPECT_TRUE(table.probe(bucketKey(5), entry));
+    EXPECT_EQ(table.getStats().collisions, 1u);
+    
+    // After a few searches the deep but stale entry is the one to go
+    for (int i = 0; i < 3; ++i) table.newSearch();
+    table.store(bucketKey(2), 1, 0, Bound::Exact, CompactMove());
+    table.store(bucketKey(3), 1, 0, Bound::Exact, CompactMove());
+    table.store(bucketKey(4), 1, 0, Bound::Exact, CompactMove());
+    table.store(bucketKey(6), 1, 0, Bound::Exact, CompactMove());
+    EXPECT_FALSE(table.probe(bucketKey(5), entry));
+    EXPECT_TRUE(table.probe(bucketKey(6), entry));
+}
+
+TEST_F(TranspositionTableTests, ClearAndResize) {
+    table.store(7, 1, 1, Bound::Exact, CompactMove());
+    table.clear();
+    TranspositionTable::Entry entry;
+    EXPECT_FALSE(table.probe(7, entry));
+    EXPECT_EQ(table.getStats().stores, 0u);
+    
+    table.resize(2);
+    EXPECT_EQ(table.sizeMB(), 2u);
+    EXPECT_EQ(table.capacity() * 16, 2u << 20);
+}
+
+TEST_F(TranspositionTableTests, ConcurrentAccessNeverTears) {
+    // Every writer stores data derived from the key, so any accepted
+    // entry must be self-consistent
+    const int threadCount = 4;
+    std::vector<std::thread> threads;
+    std::vector<int> corrupt(threadCount, 0);
+    
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t, &corrupt]() {
+            uint64_t state = 0x9E3779B97F4A7C15ull * (t + 1);
+            for (int i = 0; i < 200000; ++i) {
+                state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+                uint64_t key = state & 0xFFFFF;  // Small key space forces sharing
+                int depth = static_cast<int>(key % 100);
+                int score = static_cast<int>(key % 20000) - 10000;
+                if (i & 1) {
+                    table.store(key, depth, score, Bound::Exact, CompactMove());
+                } else {
+                    TranspositionTable::Entry entry;
+                    if (table.probe(key, entry) && (entry.depth != depth || entry.score != score)) {
+                        ++corrupt[t];
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    
+    for (int count : corrupt) EXPECT_EQ(count, 0);
+    EXPECT_GT(table.getStats().hits, 0u);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "GameModel.h"
+#include "Zobrist.h"
+#include "TestPositions.h"
+
+// Zobrist Tests
+// Tests that the incrementally maintained position key matches a full rehash
+class ZobristTests : public ::testing::Test {
+protected:
+    GameModel model;
+    
+    uint64_t fullHash() const {
+        return zobristHash(model.getBitBoard(), model.getCurrentSide());
+    }
+};
+
+TEST_F(ZobristTests, IncrementalMatchesFullHash) {
+    model.initializeStandardGame("Player1", "Player2");
+    EXPECT_EQ(model.getHash(), fullHash());
+    
+    walkGame(model, 80, 0, [&](const MoveList& moves, int) {
+        ASSERT_EQ(model.getHash(), fullHash());
+        uint64_t before = model.getHash();
+        for (const auto& entry : moves) {
+            GameModel::UndoInfo undo = model.makeMove(entry);
+            ASSERT_EQ(model.getHash(), fullHash());
+            model.unmakeMove(undo);
+            ASSERT_EQ(model.getHash(), before);
+        }
+    });
+}
+
+TEST_F(ZobristTests, CoversPromotionAndCaptures) {
+    std::vector<std::vector<Piece*>> grid(8, std::vector<Piece*>(8, nullptr));
+    grid[5][1] = new Piece("Player1", {5, 1});
+    grid[6][2] = new Piece("Player2", {6, 2});
+    grid[3][3] = new Piece("Player2", {3, 3});
+    grid[3][3]->promote();
+    model.initializeFromGrid(grid);
+    EXPECT_EQ(model.getHash(), fullHash());
+    
+    auto moves = model.getValidMoves({5, 1});
+    ASSERT_EQ(moves.size(), 1u);
+    model.executeMove(moves[0]);
+    EXPECT_TRUE(model.getBoard()[7][3]->isDame());
+    EXPECT_EQ(model.getHash(), fullHash());
+    
+    for (auto& row : grid) for (auto* piece : row) delete piece;
+}
+
+TEST_F(ZobristTests, SideToMoveChangesKey) {
+    model.initializeStandardGame("Player1", "Player2");
+    uint64_t player1ToMove = model.getHash();
+    
+    model.setCurrentPlayer("Player2");
+    EXPECT_NE(model.getHash(), player1ToMove);
+    EXPECT_EQ(model.getHash(), fullHash());
+    
+    model.setCurrentPlayer("Player1");
+    EXPECT_EQ(model.getHash(), player1ToMove);
+}
+
+TEST_F(ZobristTests, TranspositionsShareKey) {
+    // Two independent Pion moves per side played in either order
+    model.initializeStandardGame("Player1", "Player2");
+    GameModel* other = model.clone();
+    
+    auto play = [](GameModel* m, Position from, Position to) {
+        for (const auto& move : m->getValidMoves(from)) {
+            if (move.path.back() == to) { m->executeMove(move); return; }
+        }
+        FAIL() << "move not found";
+    };
+    
+    play(&model, {1, 1}, {2, 0});
+    play(&model, {6, 0}, {5, 1});
+    play(&model, {1, 7}, {2, 6});
+    play(&model, {6, 6}, {5, 7});
+    
+    play(other, {1, 7}, {2, 6});
+    play(other, {6, 6}, {5, 7});
+    play(other, {1, 1}, {2, 0});
+    play(other, {6, 0}, {5, 1});
+    
+    EXPECT_TRUE(model.getBitBoard() == other->getBitBoard());
+    EXPECT_EQ(model.getHash(), other->getHash());
+    
+    delete other;
+}